@@ -0,0 +1,230 @@
+/**
+ *  @file		json_compact_value.h
+ *  @brief	  A 16 byte json value, for holding many values in memory
+ *
+ * 	A JSONValue is as large as its largest alternative plus its index, so
+ * 	arrays of numbers spend most of their memory on nothing.  A JSONCompactValue
+ * 	keeps scalars and strings of up to 14 characters inside its 16 bytes, and
+ * 	points to longer strings, objects and arrays
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_COMPACT_VALUE_H
+#define JSON_COMPACT_VALUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "json_event_handler.h"
+#include "json_exception.h"
+#include "json_flat_map.h"
+#include "jsonable.h"
+
+namespace json {
+	class JSONCompactValue;
+
+	/// An object of compact values, kept in the order the members were added
+	using JSONCompactObject = JSONFlatMap<JSONCompactValue>;
+
+	/// An array of compact values
+	using JSONCompactArray = std::vector<JSONCompactValue>;
+
+	/**
+	 * 	@class		JSONCompactValue
+	 * 	@brief		A tagged union of every json type in 16 bytes
+	 *
+	 * 	-Copies are deep, moves leave the other value null
+	 * 	-Getters throw a JSONException if the value is not of the type asked for
+	 *
+	 */
+	class JSONCompactValue {
+		public:
+			/// The type of json value held
+			enum Type : uint8_t {
+				NULL_TYPE, BOOLEAN, INTEGER, INTEGER_64, UNSIGNED_64, DOUBLE,
+				SHORT_STRING, LONG_STRING, OBJECT, ARRAY
+			};
+
+			/// Strings up to this long are kept inside the value
+			static constexpr std::size_t SHORT_STRING_CAPACITY = 14;
+
+			/// Default Constructor, a null value
+			JSONCompactValue() :
+				length(0),
+				type(NULL_TYPE) { }
+
+			// ----- Initializing Constructors, one for each json type -----
+			JSONCompactValue(std::monostate) : JSONCompactValue() { }
+			JSONCompactValue(bool value);
+			JSONCompactValue(int value);
+			JSONCompactValue(int64_t value);
+			JSONCompactValue(uint64_t value);
+			JSONCompactValue(double value);
+			JSONCompactValue(std::string_view value);
+			JSONCompactValue(const char* value) : JSONCompactValue(std::string_view(value)) { }
+			JSONCompactValue(const std::string& value) : JSONCompactValue(std::string_view(value)) { }
+			JSONCompactValue(JSONCompactObject&& value);
+			JSONCompactValue(JSONCompactArray&& value);
+
+			/**
+			 * 	@brief	Copy Constructor
+			 *
+			 * 	Copy the value, and anything it points to
+			 *
+			 * 	@version	0.1
+			 */
+			JSONCompactValue(const JSONCompactValue& copy);
+
+			/**
+			 * 	@brief	Move Constructor
+			 *
+			 * 	Take the value, leaving the other one null
+			 *
+			 * 	@version	0.1
+			 */
+			JSONCompactValue(JSONCompactValue&& other) noexcept;
+
+			/// Copy assignment
+			JSONCompactValue& operator=(const JSONCompactValue& copy);
+
+			/// Move assignment, leaving the other value null
+			JSONCompactValue& operator=(JSONCompactValue&& other) noexcept;
+
+			// ----- Type checks -----
+			Type getType() const { return this->type; }
+			bool isNull() const { return this->type == NULL_TYPE; }
+			bool isBool() const { return this->type == BOOLEAN; }
+			bool isInteger() const { return this->type >= INTEGER && this->type <= UNSIGNED_64; }
+			bool isNumber() const { return this->type >= INTEGER && this->type <= DOUBLE; }
+			bool isString() const { return this->type == SHORT_STRING || this->type == LONG_STRING; }
+			bool isObject() const { return this->type == OBJECT; }
+			bool isArray() const { return this->type == ARRAY; }
+
+			// ----- Getters -----
+			bool getBool() const;
+
+			/// Integer value, throws if it does not fit in an int64_t
+			int64_t getInt64() const;
+
+			/// Integer value, throws if it is negative
+			uint64_t getUint64() const;
+
+			/// Any number, as a double
+			double getDouble() const;
+
+			/// The characters of a string, valid while the value is unchanged
+			std::string_view getString() const;
+
+			JSONCompactObject& getObject();
+			const JSONCompactObject& getObject() const;
+			JSONCompactArray& getArray();
+			const JSONCompactArray& getArray() const;
+
+			/**
+			 * 	@brief	Build the compact form of a JSONValue
+			 *
+			 * 	@param	const JSONValue&		The value
+			 * 	@return	JSONCompactValue		The same value
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONCompactValue fromJSONValue(const JSONValue& value);
+
+			/**
+			 * 	@brief	Build the JSONValue form of the value
+			 *
+			 * 	@return	JSONValue		The same value
+			 *
+			 * 	@version 0.1
+			 */
+			JSONValue toJSONValue() const;
+
+			/// Same type and value, integers are compared by value and objects in any order
+			bool operator==(const JSONCompactValue& other) const;
+
+			/// Different type or value
+			bool operator!=(const JSONCompactValue& other) const {
+				return !(*this == other);
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Free anything the value points to
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONCompactValue();
+
+		protected:
+			/// Scalars, short strings or the pointer (and length) of what is held elsewhere
+			alignas(8) unsigned char payload[SHORT_STRING_CAPACITY];
+
+			/// Number of characters of a short string
+			uint8_t length;
+
+			/// The type of value held
+			Type type;
+
+			/// Read a scalar or pointer from the start of the payload
+			template <typename T>
+			T load(std::size_t offset = 0) const {
+				T value;
+				std::memcpy(&value, this->payload + offset, sizeof(T));
+				return value;
+			}
+
+			/// Write a scalar or pointer to the start of the payload
+			template <typename T>
+			void store(T value, std::size_t offset = 0) {
+				std::memcpy(this->payload + offset, &value, sizeof(T));
+			}
+
+			/// Copy the value of another, which must not be this one
+			void copyFrom(const JSONCompactValue& copy);
+
+			/// Free anything pointed to, leaving the value null
+			void release();
+	};
+
+	static_assert(sizeof(JSONCompactValue) == 16, "JSONCompactValue should be 16 bytes");
+
+	/**
+	 * 	@struct		JSONCompactTraits
+	 * 	@brief		How a JSONBasicBuilder makes and fills JSONCompactValues
+	 *
+	 */
+	struct JSONCompactTraits {
+		using Value = JSONCompactValue;
+		using Object = JSONCompactObject;
+		using Array = JSONCompactArray;
+		using Key = std::string;
+
+		Value makeObject() const { return JSONCompactObject(); }
+		Value makeArray() const { return JSONCompactArray(); }
+		Key makeKey() const { return Key(); }
+		Value makeString(std::string_view value) const { return value; }
+		Value makeNull() const { return JSONCompactValue(); }
+
+		/// Get the object a value holds, or nullptr if it holds an array
+		static Object* getObject(Value& value) { return value.isObject() ? &value.getObject() : nullptr; }
+
+		/// Get the array a value holds
+		static Array& getArray(Value& value) { return value.getArray(); }
+	};
+
+	/// Builds a JSONCompactValue from events
+	using JSONCompactBuilder = JSONBasicBuilder<JSONCompactTraits>;
+
+	// Built once, in json_compact_value.cpp
+	extern template class JSONBasicBuilder<JSONCompactTraits>;
+}
+#endif
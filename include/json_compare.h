@@ -7,12 +7,14 @@
  *  
  *  @author		Gabriel Shelton	sheltongabe
  *  @date		  08-02-2018
- *  @version	0.4
+ *  @version	0.5
  */
 
 #ifndef JSON_COMPARE_H
 #define JSON_COMPARE_H
 
+#include <type_traits>
+
 #include "jsonable.h"
 
 namespace json {
@@ -28,7 +30,7 @@ namespace json {
 	 */
 	struct JSONCompare {
 		/// Left hand side of the comparison
-		JSONValue& left;
+		const JSONValue& left;
 
 		/// Used for comparing doubles, if they are that close they are considered equal
 		static constexpr double EPSILON = 0.000001;
@@ -49,7 +51,7 @@ namespace json {
 		 * 
 		 * 	@version	0.4
 		 */
-		JSONCompare(JSONValue& left) : left(left) { }
+		JSONCompare(const JSONValue& left) : left(left) { }
 
 		/**
 		 * 	@brief 	Compare for a double
@@ -57,16 +59,16 @@ namespace json {
 		 * 	@param double	  	    Right hand side of the comparison
 		 * 	@return bool				Result of the comparison 
 		 */
-		bool operator()(double& right);
+		bool operator()(const double& right);
 
 		// ----- Comparisons -----
 		/**
-		 * 	@brief 	Compare for a JSONObject
+		 * 	@brief 	Compare for a JSONObject, members are matched by key in any order
 		 * 
 		 * 	@param JSONObject 	Right hand side of the comparison
 		 * 	@return bool				Result of the comparison 
 		 */
-		bool operator()(JSONObject& right);
+		bool operator()(const JSONObject& right);
 
 		/**
 		 * 	@brief 	Compare for a JSONArray
@@ -74,7 +76,7 @@ namespace json {
 		 * 	@param JSONArray 	 Right hand side of the comparison
 		 * 	@return bool				Result of the comparison 
 		 */
-		bool operator()(JSONArray& right);
+		bool operator()(const JSONArray& right);
 
 		/**
 		 * 	@brief 	Compare for std::monostate
@@ -82,16 +84,35 @@ namespace json {
 		 * 	@param std::monostate 	 Right hand side of the comparison
 		 * 	@return bool						Result of the comparison 
 		 */
-		bool operator()(std::monostate& right);
+		bool operator()(const std::monostate& right);
 
 		/**
 		 * 	@brief 	Compare for a generic auto determined type
 		 * 
+		 * 	Integers are equal when their values are, no matter which width stores them
+		 * 
 		 * 	@param T				 	 Right hand side of the comparison
 		 * 	@return bool				Result of the comparison 
 		 */
 		template<typename T>
-		bool operator()(T& right);
+		bool operator()(const T& right);
+
+		/**
+		 * 	@brief	Compare two integers of possibly different signedness by value
+		 * 
+		 * 	@param	A				 Left integer
+		 * 	@param	B				 Right integer
+		 * 	@return bool			If the values are equal
+		 */
+		template<typename A, typename B>
+		static bool integerEqual(A left, B right) {
+			if constexpr(std::is_signed_v<A> == std::is_signed_v<B>)
+				return left == right;
+			else if constexpr(std::is_signed_v<A>)
+				return left >= 0 && static_cast<uint64_t>(left) == right;
+			else
+				return right >= 0 && left == static_cast<uint64_t>(right);
+		}
 
 		/**
 		 * 	@brief	Destructor
@@ -0,0 +1,248 @@
+/**
+ *  @file		json_cursor.h
+ *  @brief	  Walk a buffer of json text in place, without copying it
+ *
+ * 	A JSONCursor is a pair of pointers into json text that is owned by someone
+ * 	else, it is advanced byte by byte by the parsers and hands back views of
+ * 	the strings and tokens it passes over
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.2
+ */
+
+#ifndef JSON_CURSOR_H
+#define JSON_CURSOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "json_exception.h"
+#include "json_structural_index.h"
+
+namespace json {
+
+	/**
+	 * 	@struct		JSONCursor
+	 * 	@brief		 A read position inside of a buffer of json text
+	 *
+	 * 	The cursor never owns the text, so the buffer must outlive it and anything
+	 * 	returned as a std::string_view from it.  When a JSONStructuralIndex of the
+	 * 	text is attached, whitespace, strings and bare values are skipped by jumping
+	 * 	to the next indexed position instead of testing each byte.
+	 *
+	 */
+	struct JSONCursor {
+		/// First character of the text
+		const char* begin;
+
+		/// Next character to be read
+		const char* current;
+
+		/// One past the last character of the text
+		const char* end;
+
+		/// Next position of the attached structural index, nullptr if there is none
+		const uint32_t* token = nullptr;
+
+		/// One past the last position of the attached structural index
+		const uint32_t* tokenEnd = nullptr;
+
+		/**
+		 * 	@brief	Initializing Constructor
+		 *
+		 * 	@param	std::string_view		The text being walked
+		 *
+		 * 	@version	0.1
+		 */
+		JSONCursor(std::string_view text) :
+			begin(text.data()),
+			current(text.data()),
+			end(text.data() + text.size()) { }
+
+		/**
+		 * 	@brief	Initializing Constructor
+		 *
+		 * 	@param	const char*		Start of the text being walked
+		 * 	@param	std::size_t		Number of characters in the text
+		 *
+		 * 	@version	0.1
+		 */
+		JSONCursor(const char* data, std::size_t length) :
+			begin(data),
+			current(data),
+			end(data + length) { }
+
+		/**
+		 * 	@brief	Use a structural index of the text to jump between tokens
+		 *
+		 * 	The index must have been built from the same text, and must outlive the cursor
+		 *
+		 * 	@param	const JSONStructuralIndex&		A valid index of the text
+		 */
+		void setIndex(const JSONStructuralIndex& index) {
+			const std::vector<uint32_t>& positions = index.getPositions();
+			this->token = positions.data();
+			this->tokenEnd = positions.data() + positions.size();
+		}
+
+		/**
+		 * 	@brief	Check if every character has been read
+		 *
+		 * 	@return	bool		If the cursor is at the end of the text
+		 */
+		bool atEnd() const {
+			return this->current >= this->end;
+		}
+
+		/**
+		 * 	@brief	Look at the next character without consuming it
+		 *
+		 * 	@return	char		The next character or '\0' at the end of the text
+		 */
+		char peek() const {
+			return (this->current < this->end) ? *this->current : '\0';
+		}
+
+		/**
+		 * 	@brief	Consume and return the next character
+		 *
+		 * 	@return	char		The next character or '\0' at the end of the text
+		 */
+		char get() {
+			return (this->current < this->end) ? *this->current++ : '\0';
+		}
+
+		/**
+		 * 	@brief	Move past any json whitespace (space, tab, newline, carriage return)
+		 */
+		void skipWhitespace() {
+			// With an index the next token start is the next non-whitespace character
+			if(this->token != nullptr) {
+				this->current = this->seekToken() ? this->begin + *this->token : this->end;
+				return;
+			}
+
+			while(this->current < this->end && JSONCursor::isWhitespace(*this->current))
+				++this->current;
+		}
+
+		/**
+		 * 	@brief	Skip whitespace and look at the next character
+		 *
+		 * 	@return	char		The next non-whitespace character or '\0' at the end
+		 */
+		char peekNonSpace() {
+			this->skipWhitespace();
+			return this->peek();
+		}
+
+		/**
+		 * 	@brief	Skip whitespace and consume the expected character
+		 *
+		 * 	@param	char				The character that must come next
+		 * 	@param	const char*		What was being parsed, used in the error message
+		 * 	@throw	  JSONException	If the next character is not the expected one
+		 */
+		void expect(char c, const char* context) {
+			if(this->peekNonSpace() != c)
+				this->fail(context);
+			++this->current;
+		}
+
+		/**
+		 * 	@brief	Read a quoted string, the cursor must be on the opening quote
+		 *
+		 * 	Either ' or " can open the string, it is closed by the same character
+		 * 	when that is not escaped.  Escapes are left in the text, JSONString
+		 * 	reads them.
+		 *
+		 * 	@return	std::string_view		The text between the quotes
+		 * 	@throw	  JSONException		  If the string is never closed
+		 *
+		 * 	@version 0.1
+		 */
+		std::string_view readString();
+
+		/**
+		 * 	@brief	Read an unquoted token (number, true, false, null)
+		 *
+		 * 	Reads until whitespace or one of the characters , : } ]
+		 *
+		 * 	@return	std::string_view		The token read, may be empty
+		 *
+		 * 	@version 0.1
+		 */
+		std::string_view readToken();
+
+		/**
+		 * 	@brief	Move past the next value without building it
+		 *
+		 * 	Objects and arrays are skipped by matching brackets, their contents are
+		 * 	only checked enough to find where they end
+		 *
+		 * 	@throw	  JSONException		  If the text ends before the value does
+		 *
+		 * 	@version 0.1
+		 */
+		void skipValue();
+
+		/**
+		 * 	@brief	Jump forward to a position in the text
+		 *
+		 * 	The index position is found with a binary search, so long jumps are cheap
+		 *
+		 * 	@param	std::size_t		Offset to move to, at or after the cursor
+		 */
+		void moveTo(std::size_t at) {
+			this->current = this->begin + at;
+			if(this->token != nullptr)
+				this->token = std::lower_bound(this->token, this->tokenEnd, static_cast<uint32_t>(at));
+		}
+
+		/**
+		 * 	@brief	Move the index position up to the cursor
+		 *
+		 * 	@return	bool		If there is an indexed position at or after the cursor
+		 */
+		bool seekToken() {
+			const std::size_t at = this->offset();
+			while(this->token < this->tokenEnd && *this->token < at)
+				++this->token;
+			return this->token < this->tokenEnd;
+		}
+
+		/**
+		 * 	@brief	How far into the text the cursor is
+		 *
+		 * 	@return	std::size_t		Number of characters already read
+		 */
+		std::size_t offset() const {
+			return static_cast<std::size_t>(this->current - this->begin);
+		}
+
+		/**
+		 * 	@brief	Throw a JSONException describing where parsing failed
+		 *
+		 * 	@param	const char*		What was being parsed
+		 * 	@throw	  JSONException	Always
+		 *
+		 * 	@version 0.1
+		 */
+		[[noreturn]] void fail(const char* context) const;
+
+		/**
+		 * 	@brief	Check if the character is json whitespace
+		 *
+		 * 	@param	char		Character to check
+		 * 	@return	bool		If it is a space, tab, newline or carriage return
+		 */
+		static bool isWhitespace(char c) {
+			return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+		}
+	};
+}
+#endif
@@ -0,0 +1,196 @@
+/**
+ *  @file		json_event_parser.h
+ *  @brief	  Parse json text that arrives in pieces, reporting it to a JSONEventHandler
+ *
+ * 	Text is pushed into the parser a chunk at a time, chunks may split the text
+ * 	anywhere (even in the middle of a string or number), and only the piece of
+ * 	a string or token that crosses a chunk boundary is ever copied.  Memory use
+ * 	depends on how deeply the json is nested, not how large it is.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_EVENT_PARSER_H
+#define JSON_EVENT_PARSER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json_event_handler.h"
+#include "json_exception.h"
+
+namespace json {
+
+	/**
+	 * 	@class		JSONEventParser
+	 * 	@brief		A push parser that keeps its place between chunks of text
+	 *
+	 * 	-feed: chunk of text -> events reported to the handler
+	 * 	-finish: checks the text ended with a whole value, and resets for the next text
+	 *
+	 */
+	class JSONEventParser {
+		public:
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	Deleted, there has to be a handler to report to
+			 *
+			 * 	@version	0.1
+			 */
+			JSONEventParser() = delete;
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	@param	JSONEventHandler&		The handler to report to, must outlive the parser
+			 *
+			 * 	@version	0.1
+			 */
+			JSONEventParser(JSONEventHandler& handler);
+
+			/**
+			 * 	@brief	Parse the next chunk of text
+			 *
+			 * 	@param	const char*				Start of the chunk
+			 * 	@param	std::size_t				Number of characters in the chunk
+			 * 	@throw	  JSONException		  If the text is not valid json
+			 *
+			 * 	@version 0.1
+			 */
+			void feed(const char* data, std::size_t length);
+
+			/**
+			 * 	@brief	Parse the next chunk of text
+			 *
+			 * 	@param	std::string_view		The chunk
+			 * 	@throw	  JSONException		  If the text is not valid json
+			 */
+			void feed(std::string_view chunk) {
+				this->feed(chunk.data(), chunk.size());
+			}
+
+			/**
+			 * 	@brief	Mark the end of the text
+			 *
+			 * 	A bare value at the end of the text is only reported now, since until
+			 * 	then more of it could still arrive.  Afterwards the parser is ready for a new text.
+			 *
+			 * 	@throw	  JSONException		  If the text ended before a whole value was read
+			 *
+			 * 	@version 0.1
+			 */
+			void finish();
+
+			/**
+			 * 	@brief	Forget any text fed so far
+			 *
+			 * 	@version 0.1
+			 */
+			void reset();
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONEventParser();
+
+		protected:
+			/// What the parser is waiting to read next
+			enum State {
+				VALUE,				///< Any value
+				ARRAY_VALUE,	   ///< A value, or the ']' that ends the array
+				OBJECT_KEY,		  ///< A key, or the '}' that ends the object
+				COLON,				 ///< The ':' between a key and its value
+				AFTER_VALUE,	  ///< A ',' or the end of the open container
+				DONE					///< Nothing but whitespace
+			};
+
+			/// The handler events are reported to
+			JSONEventHandler& handler;
+
+			/// What is expected next
+			State state;
+
+			/// The open containers, '{' or '[', innermost last
+			std::vector<char> containers;
+
+			/// A string or token that was cut off by the end of a chunk
+			std::string pending;
+
+			/// The quote that opened the string being read, or '\0' if not in a string
+			char openQuote;
+
+			/// The characters of the last string that had escapes
+			std::string characters;
+
+			/// If a bare token is being read
+			bool inToken;
+
+			/// Number of characters fed before the current chunk
+			std::size_t consumed;
+
+			/**
+			 * 	@brief	Report a finished string, as a key or a value depending on the state
+			 *
+			 * 	@param	std::string_view		Text of the string, escapes are read here
+			 *
+			 * 	@version 0.1
+			 */
+			void endString(std::string_view text);
+
+			/**
+			 * 	@brief	Convert and report a finished bare token
+			 *
+			 * 	@param	std::string_view		The token
+			 * 	@param	std::size_t				 Offset of the token, for errors
+			 *
+			 * 	@version 0.1
+			 */
+			void endToken(std::string_view text, std::size_t offset);
+
+			/**
+			 * 	@brief	Move to the state following a finished value
+			 */
+			void endValue() {
+				this->state = this->containers.empty() ? DONE : AFTER_VALUE;
+			}
+
+			/**
+			 * 	@brief	Throw a JSONException describing where parsing failed
+			 *
+			 * 	@param	const char*		What went wrong
+			 * 	@param	std::size_t		Offset into the whole text
+			 * 	@throw	  JSONException	Always
+			 *
+			 * 	@version 0.1
+			 */
+			[[noreturn]] void fail(const char* context, std::size_t offset) const;
+
+			/**
+			 * 	@brief	Check if a character ends a bare token
+			 *
+			 * 	@param	char		Character to check
+			 * 	@return	bool		If it is whitespace, punctuation or a quote
+			 */
+			static bool isDelimiter(char c) {
+				switch(c) {
+					case ' ': case '\t': case '\n': case '\r':
+					case ',': case ':': case '{': case '}': case '[': case ']':
+					case '"': case '\'':
+						return true;
+
+					default:
+						return false;
+				}
+			}
+	};
+}
+#endif
@@ -0,0 +1,396 @@
+/**
+ *  @file		json_flat_map.h
+ *  @brief	  The storage of a JSON object, members kept in one contiguous array
+ *
+ * 	Members stay in the order they were added.  Small objects are searched by
+ * 	scanning the array, larger ones also keep an open addressing hash index of
+ * 	positions in the array.  The interface follows std::map closely enough that
+ * 	code iterating or looking up members does not change.  Keys are JSONKeys, so
+ * 	lookups with a JSONKey use its stored hash and compare interned keys by pointer
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.2
+ */
+
+#ifndef JSON_FLAT_MAP_H
+#define JSON_FLAT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json_key.h"
+
+namespace json {
+
+	/**
+	 * 	@class		JSONFlatMap
+	 * 	@brief		An insertion ordered map from JSONKey to Value stored in a std::vector
+	 *
+	 * 	-Iterators are std::vector iterators over std::pair<JSONKey, Value>, so they
+	 * 	are invalidated by adding or erasing members, and keys must not be changed
+	 * 	through them
+	 * 	-Lookups take a JSONKey or anything convertible to a std::string_view
+	 * 	-Comparing with == ignores the order of the members
+	 *
+	 */
+	template <typename Value>
+	class JSONFlatMap {
+		public:
+			using key_type = JSONKey;
+			using mapped_type = Value;
+			using value_type = std::pair<JSONKey, Value>;
+			using size_type = std::size_t;
+			using iterator = typename std::vector<value_type>::iterator;
+			using const_iterator = typename std::vector<value_type>::const_iterator;
+
+			/// Objects with more members than this are given a hash index
+			static constexpr std::size_t INDEX_THRESHOLD = 16;
+
+			/// Default Constructor
+			JSONFlatMap() = default;
+
+			/// Construct with the members given, later duplicates of a key are ignored
+			JSONFlatMap(std::initializer_list<value_type> members) {
+				this->reserve(members.size());
+				for(const value_type& member : members)
+					this->emplace(member.first, member.second);
+			}
+
+			// ----- Iteration, in the order members were added -----
+			iterator begin() { return this->members.begin(); }
+			iterator end() { return this->members.end(); }
+			const_iterator begin() const { return this->members.begin(); }
+			const_iterator end() const { return this->members.end(); }
+			const_iterator cbegin() const { return this->members.cbegin(); }
+			const_iterator cend() const { return this->members.cend(); }
+
+			/// Number of members
+			size_type size() const { return this->members.size(); }
+
+			/// If there are no members
+			bool empty() const { return this->members.empty(); }
+
+			/// Make room for a number of members without reallocating
+			void reserve(size_type count) { this->members.reserve(count); }
+
+			/// Bytes allocated for the members and the index, not counting what the members allocate
+			std::size_t getAllocatedBytes() const {
+				return this->members.capacity() * sizeof(value_type) + this->slots.capacity() * sizeof(uint32_t);
+			}
+
+			/// Remove every member
+			void clear() {
+				this->members.clear();
+				this->slots.clear();
+			}
+
+			/**
+			 * 	@brief	Find the member with the key
+			 *
+			 * 	@param	K		The key, a JSONKey or anything convertible to std::string_view
+			 * 	@return	iterator		The member, or end() if there is none
+			 */
+			template <typename K>
+			iterator find(const K& key) {
+				return this->members.begin() + this->findIndex(key);
+			}
+
+			/// Find the member with the key, or end() if there is none
+			template <typename K>
+			const_iterator find(const K& key) const {
+				return this->members.begin() + this->findIndex(key);
+			}
+
+			/// Find the member with a key whose hash was worked out beforehand, or end() if there is none
+			iterator find(const JSONKey& key, size_type hash) {
+				return this->members.begin() + this->findKey(key, hash);
+			}
+
+			/// Find the member with a key whose hash was worked out beforehand, or end() if there is none
+			const_iterator find(const JSONKey& key, size_type hash) const {
+				return this->members.begin() + this->findKey(key, hash);
+			}
+
+			/// Number of members with the key, 0 or 1
+			template <typename K>
+			size_type count(const K& key) const {
+				return (this->findIndex(key) != this->size()) ? 1 : 0;
+			}
+
+			/// If there is a member with the key
+			template <typename K>
+			bool contains(const K& key) const {
+				return this->findIndex(key) != this->size();
+			}
+
+			/**
+			 * 	@brief	Get the value of the member with the key
+			 *
+			 * 	@param	K		The key, a JSONKey or anything convertible to std::string_view
+			 * 	@return	Value&		The value
+			 * 	@throw	  std::out_of_range		If there is no member with the key
+			 */
+			template <typename K>
+			Value& at(const K& key) {
+				const size_type index = this->findIndex(key);
+				if(index == this->size())
+					throw std::out_of_range("No json member with the key: " + std::string(std::string_view(key)));
+				return this->members[index].second;
+			}
+
+			/// Get the value of the member with the key, throw std::out_of_range if there is none
+			template <typename K>
+			const Value& at(const K& key) const {
+				const size_type index = this->findIndex(key);
+				if(index == this->size())
+					throw std::out_of_range("No json member with the key: " + std::string(std::string_view(key)));
+				return this->members[index].second;
+			}
+
+			/// Get the value of the member with the key, adding a default value if there is none
+			template <typename K>
+			Value& operator[](K&& key) {
+				return this->try_emplace(std::forward<K>(key)).first->second;
+			}
+
+			/**
+			 * 	@brief	Add a member if there is none with the key yet
+			 *
+			 * 	@param	K				The key, anything a JSONKey can be built from
+			 * 	@param	Args			Arguments the value is built from
+			 * 	@return	std::pair<iterator, bool>		The member with the key, and if it was added
+			 */
+			template <typename K, typename... Args>
+			std::pair<iterator, bool> emplace(K&& key, Args&&... args) {
+				const size_type index = this->findIndex(key);
+				if(index != this->size())
+					return { this->members.begin() + index, false };
+
+				this->members.emplace_back(std::piecewise_construct,
+						std::forward_as_tuple(std::forward<K>(key)),
+						std::forward_as_tuple(std::forward<Args>(args)...));
+				this->indexLast();
+				return { this->members.end() - 1, true };
+			}
+
+			/// Add a member if there is none with the key yet
+			template <typename K, typename... Args>
+			std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+				return this->emplace(std::forward<K>(key), std::forward<Args>(args)...);
+			}
+
+			/// Add a member if there is none with its key yet
+			std::pair<iterator, bool> insert(const value_type& member) {
+				return this->emplace(member.first, member.second);
+			}
+
+			/// Add a member if there is none with its key yet
+			std::pair<iterator, bool> insert(value_type&& member) {
+				return this->emplace(std::move(member.first), std::move(member.second));
+			}
+
+			/// Add a member, or replace the value of the member with the key
+			template <typename K, typename M>
+			std::pair<iterator, bool> insert_or_assign(K&& key, M&& value) {
+				std::pair<iterator, bool> result = this->emplace(std::forward<K>(key), std::forward<M>(value));
+				if(!result.second)
+					result.first->second = std::forward<M>(value);
+				return result;
+			}
+
+			/**
+			 * 	@brief	Remove a member, keeping the order of the rest
+			 *
+			 * 	The index drops the member and moves the positions after it down, the
+			 * 	other keys are not placed again.  Removing many members at once is
+			 * 	cheaper with the range erase.
+			 *
+			 * 	@param	const_iterator		The member
+			 * 	@return	iterator		The member after the one removed
+			 */
+			iterator erase(const_iterator position) {
+				const size_type index = static_cast<size_type>(position - this->members.cbegin());
+				if(!this->slots.empty()) {
+					if(this->size() - 1 <= JSONFlatMap::INDEX_THRESHOLD)
+						this->slots.clear();
+					else
+						this->unindex(index);
+				}
+				this->members.erase(position);
+				return this->members.begin() + index;
+			}
+
+			/// Remove the members from first up to last, keeping the order of the rest, and index once
+			iterator erase(const_iterator first, const_iterator last) {
+				const size_type index = static_cast<size_type>(first - this->members.cbegin());
+				if(first != last) {
+					this->members.erase(first, last);
+					this->rebuildIndex();
+				}
+				return this->members.begin() + index;
+			}
+
+			/// Remove the member with the key, returning the number removed
+			template <typename K, typename = std::enable_if_t<!std::is_convertible_v<const K&, const_iterator>>>
+			size_type erase(const K& key) {
+				const size_type index = this->findIndex(key);
+				if(index == this->size())
+					return 0;
+
+				this->erase(this->members.cbegin() + index);
+				return 1;
+			}
+
+			/// Same members with equal values, in any order
+			bool operator==(const JSONFlatMap& other) const {
+				if(this->size() != other.size())
+					return false;
+
+				for(const value_type& member : this->members) {
+					const size_type index = other.findIndex(member.first);
+					if(index == other.size() || !(member.second == other.members[index].second))
+						return false;
+				}
+				return true;
+			}
+
+			/// Differing members or values
+			bool operator!=(const JSONFlatMap& other) const {
+				return !(*this == other);
+			}
+
+		protected:
+			/// The members, in the order they were added
+			std::vector<value_type> members;
+
+			/// Hash index, a power of two in size, each slot is a member's position + 1 or 0 if empty
+			std::vector<uint32_t> slots;
+
+			/**
+			 * 	@brief	Find the position of the member with the key
+			 *
+			 * 	A JSONKey is compared as a JSONKey, with its own hash, anything else as
+			 * 	a std::string_view
+			 *
+			 * 	@param	K		The key
+			 * 	@return	size_type		The position, or size() if there is none
+			 */
+			template <typename K>
+			size_type findIndex(const K& key) const {
+				if constexpr(std::is_same_v<K, JSONKey>)
+					return this->findKey(key, key.getHash());
+				else
+					return this->findKey(std::string_view(key), JSONFlatMap::hashKey(std::string_view(key)));
+			}
+
+			/**
+			 * 	@brief	Find the position of the member with the key
+			 *
+			 * 	@param	const T&		The key, a JSONKey or std::string_view
+			 * 	@param	size_type		Hash of the key, only used once there is an index
+			 * 	@return	size_type		The position, or size() if there is none
+			 */
+			template <typename T>
+			size_type findKey(const T& key, size_type hash) const {
+				// Without an index scan the members
+				if(this->slots.empty()) {
+					for(size_type i = 0; i < this->members.size(); ++i) {
+						if(this->members[i].first == key)
+							return i;
+					}
+					return this->members.size();
+				}
+
+				// Probe from the key's slot until the key or an empty slot is found
+				const size_type mask = this->slots.size() - 1;
+				for(size_type slot = hash & mask; ; slot = (slot + 1) & mask) {
+					const uint32_t entry = this->slots[slot];
+					if(entry == 0)
+						return this->members.size();
+					if(this->members[entry - 1].first == key)
+						return entry - 1;
+				}
+			}
+
+			/// Add the last member to the index, growing it to stay at most half full
+			void indexLast() {
+				if(this->slots.empty() ? this->size() > JSONFlatMap::INDEX_THRESHOLD :
+						this->size() * 2 > this->slots.size())
+					this->rebuildIndex();
+				else if(!this->slots.empty())
+					this->place(this->size() - 1);
+			}
+
+			/// Build the index from the members, or drop it if the object has become small
+			void rebuildIndex() {
+				if(this->size() <= JSONFlatMap::INDEX_THRESHOLD) {
+					this->slots.clear();
+					return;
+				}
+
+				size_type capacity = 2 * JSONFlatMap::INDEX_THRESHOLD;
+				while(capacity < this->size() * 4)
+					capacity *= 2;
+
+				this->slots.assign(capacity, 0);
+				for(size_type i = 0; i < this->size(); ++i)
+					this->place(i);
+			}
+
+			/// Put the member's position in the first free slot from its key's slot
+			void place(size_type index) {
+				const size_type mask = this->slots.size() - 1;
+				size_type slot = this->members[index].first.getHash() & mask;
+				while(this->slots[slot] != 0)
+					slot = (slot + 1) & mask;
+				this->slots[slot] = static_cast<uint32_t>(index + 1);
+			}
+
+			/**
+			 * 	@brief	Take a member out of the index, and move the positions after it down by one
+			 *
+			 * 	Entries later in the probe run are shifted back into the freed slot, so no
+			 * 	lookup stops early and nothing is hashed again.  Must be called before
+			 * 	the member is erased.
+			 *
+			 * 	@param	size_type		Position of the member
+			 */
+			void unindex(size_type index) {
+				const size_type mask = this->slots.size() - 1;
+				size_type hole = this->members[index].first.getHash() & mask;
+				while(this->slots[hole] != index + 1)
+					hole = (hole + 1) & mask;
+
+				// An entry can fill the hole if the hole lies between its key's slot and where it is
+				for(size_type next = (hole + 1) & mask; this->slots[next] != 0; next = (next + 1) & mask) {
+					const size_type home = this->members[this->slots[next] - 1].first.getHash() & mask;
+					if(((next - home) & mask) >= ((next - hole) & mask)) {
+						this->slots[hole] = this->slots[next];
+						hole = next;
+					}
+				}
+				this->slots[hole] = 0;
+
+				// Without a branch the pass over the slots is vectorized
+				const uint32_t erased = static_cast<uint32_t>(index + 1);
+				for(uint32_t& entry : this->slots)
+					entry -= (entry > erased);
+			}
+
+			/// Hash of a key
+			static size_type hashKey(std::string_view key) {
+				return std::hash<std::string_view>{}(key);
+			}
+	};
+}
+#endif
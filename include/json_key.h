@@ -0,0 +1,262 @@
+/**
+ *  @file		json_key.h
+ *  @brief	  The key of a member of a JSON object, and a pool that interns them
+ *
+ * 	Keys of up to 15 characters are kept inside the 16 byte JSONKey.  Longer
+ * 	keys point to a reference counted block holding the characters and their
+ * 	hash, which a JSONKeyPool shares between every key with the same text, so
+ * 	equal interned keys compare by pointer
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_KEY_H
+#define JSON_KEY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace json {
+
+	/**
+	 * 	@class		JSONKey
+	 * 	@brief		An immutable string used as the key of object members
+	 *
+	 * 	Converts to std::string_view and std::string, so it can be used where the
+	 * 	keys used to be std::strings.  Copies of long keys share their characters.
+	 *
+	 */
+	class JSONKey {
+		public:
+			/// Keys up to this long are kept inside the key
+			static constexpr std::size_t INLINE_CAPACITY = 15;
+
+			/// Default Constructor, an empty key
+			JSONKey() : bytes{} { }
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	@param	std::string_view		The text of the key
+			 * 	@throw	  JSONException		  If the key is longer than 4GB
+			 *
+			 * 	@version	0.1
+			 */
+			JSONKey(std::string_view text);
+
+			/// Initializing Constructor from a c string
+			JSONKey(const char* text) : JSONKey(std::string_view(text)) { }
+
+			/// Initializing Constructor from a std::string
+			JSONKey(const std::string& text) : JSONKey(std::string_view(text)) { }
+
+			/// Copy Constructor, long keys share their characters
+			JSONKey(const JSONKey& copy) {
+				std::memcpy(this->bytes, copy.bytes, sizeof(this->bytes));
+				if(this->isShared())
+					this->getShared()->references.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/// Move Constructor, leaving the other key empty
+			JSONKey(JSONKey&& other) noexcept {
+				std::memcpy(this->bytes, other.bytes, sizeof(this->bytes));
+				std::memset(other.bytes, 0, sizeof(other.bytes));
+			}
+
+			/// Copy assignment
+			JSONKey& operator=(const JSONKey& copy) {
+				JSONKey temporary(copy);
+				return *this = std::move(temporary);
+			}
+
+			/// Move assignment, leaving the other key empty
+			JSONKey& operator=(JSONKey&& other) noexcept {
+				if(this != &other) {
+					if(this->isShared())
+						this->release();
+					std::memcpy(this->bytes, other.bytes, sizeof(this->bytes));
+					std::memset(other.bytes, 0, sizeof(other.bytes));
+				}
+				return *this;
+			}
+
+			/// The characters of the key
+			std::string_view view() const {
+				if(this->isShared()) {
+					const Shared* shared = this->getShared();
+					return std::string_view(reinterpret_cast<const char*>(shared + 1), shared->length);
+				}
+				return std::string_view(reinterpret_cast<const char*>(this->bytes), this->bytes[INLINE_CAPACITY]);
+			}
+
+			// ----- Use as a string -----
+			operator std::string_view() const { return this->view(); }
+			operator std::string() const { return std::string(this->view()); }
+			std::string str() const { return std::string(this->view()); }
+			const char* data() const { return this->view().data(); }
+			std::size_t size() const { return this->view().size(); }
+			std::size_t length() const { return this->view().size(); }
+			bool empty() const { return this->view().empty(); }
+
+			/**
+			 * 	@brief	Get the hash of the key, the same as std::hash<std::string_view> of its text
+			 *
+			 * 	@return	std::size_t		The hash, stored with long keys
+			 */
+			std::size_t getHash() const {
+				return this->isShared() ? this->getShared()->hash : std::hash<std::string_view>{}(this->view());
+			}
+
+			/// If the characters are held outside of the key
+			bool isShared() const {
+				return this->bytes[INLINE_CAPACITY] == SHARED;
+			}
+
+			/// Bytes of the block a long key's characters are in, 0 for a short key
+			std::size_t getAllocatedBytes() const {
+				return this->isShared() ? sizeof(Shared) + this->getShared()->length : 0;
+			}
+
+			/// Keys are equal if they hold the same text, interned keys compare by pointer
+			friend bool operator==(const JSONKey& left, const JSONKey& right) {
+				// Short keys are all of their bytes, unused ones are zero
+				if(!left.isShared() || !right.isShared())
+					return std::memcmp(left.bytes, right.bytes, sizeof(left.bytes)) == 0;
+
+				const Shared* leftShared = left.getShared();
+				const Shared* rightShared = right.getShared();
+				return leftShared == rightShared ||
+						(leftShared->hash == rightShared->hash && left.view() == right.view());
+			}
+
+			// ----- Comparisons with other strings -----
+			friend bool operator==(const JSONKey& left, std::string_view right) { return left.view() == right; }
+			friend bool operator==(std::string_view left, const JSONKey& right) { return left == right.view(); }
+			friend bool operator==(const JSONKey& left, const std::string& right) { return left.view() == right; }
+			friend bool operator==(const std::string& left, const JSONKey& right) { return left == right.view(); }
+			friend bool operator==(const JSONKey& left, const char* right) { return left.view() == right; }
+			friend bool operator==(const char* left, const JSONKey& right) { return left == right.view(); }
+			friend bool operator!=(const JSONKey& left, const JSONKey& right) { return !(left == right); }
+			friend bool operator!=(const JSONKey& left, std::string_view right) { return !(left == right); }
+			friend bool operator!=(const JSONKey& left, const std::string& right) { return !(left == right); }
+			friend bool operator!=(const JSONKey& left, const char* right) { return !(left == right); }
+			friend bool operator<(const JSONKey& left, const JSONKey& right) { return left.view() < right.view(); }
+
+			/// Write the text of the key
+			friend std::ostream& operator<<(std::ostream& out, const JSONKey& key) {
+				return out << key.view();
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Free the characters of a long key once no key shares them
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONKey() {
+				if(this->isShared())
+					this->release();
+			}
+
+		protected:
+			/// Header of the block a long key's characters follow
+			struct Shared {
+				std::atomic<uint32_t> references;
+				uint32_t length;
+				std::size_t hash;
+			};
+
+			/// Value of the last byte when the key is long
+			static constexpr unsigned char SHARED = 0xFF;
+
+			/// The characters and length (last byte) of a short key, or the address of a long key's block
+			alignas(8) unsigned char bytes[INLINE_CAPACITY + 1];
+
+			/// The block of a long key
+			Shared* getShared() const {
+				Shared* shared;
+				std::memcpy(&shared, this->bytes, sizeof(shared));
+				return shared;
+			}
+
+			/// Drop this key's reference to its block, freeing the block if it was the last
+			void release();
+	};
+
+	/**
+	 * 	@class		JSONKeyPool
+	 * 	@brief		An intern table of keys, every long key with the same text shares one block
+	 *
+	 * 	The pool holds a reference to each key it has handed out, keys stay valid
+	 * 	after the pool is gone.  Interning is thread safe.
+	 *
+	 */
+	class JSONKeyPool {
+		public:
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	Start with no keys
+			 *
+			 * 	@version	0.1
+			 */
+			JSONKeyPool();
+
+			/// Copying is not allowed
+			JSONKeyPool(const JSONKeyPool& copy) = delete;
+
+			/**
+			 * 	@brief	Get the key for the text, sharing the block of an earlier key with the same text
+			 *
+			 * 	@param	std::string_view		The text of the key
+			 * 	@return	JSONKey		The interned key
+			 *
+			 * 	@version 0.1
+			 */
+			JSONKey intern(std::string_view text);
+
+			/**
+			 * 	@brief	Get the number of distinct long keys held
+			 *
+			 * 	@return	std::size_t		Number of keys, short keys are not held
+			 *
+			 * 	@version 0.1
+			 */
+			std::size_t size() const;
+
+			/**
+			 * 	@brief	Let go of every key held, keys handed out are unaffected
+			 *
+			 * 	@version 0.1
+			 */
+			void clear();
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONKeyPool();
+
+		protected:
+			/// Guards keys
+			mutable std::mutex mutex;
+
+			/// Each long key held, by its text (which the key owns)
+			std::unordered_map<std::string_view, JSONKey> keys;
+	};
+}
+#endif
@@ -0,0 +1,84 @@
+/**
+ *  @file		json_mapped_file.h
+ *  @brief	  Map a json file into memory so it can be parsed where it lies
+ *
+ * 	The file is mapped read-only and advised for sequential access, the
+ * 	mapping is released when the JSONMappedFile is destroyed
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_MAPPED_FILE_H
+#define JSON_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "json_exception.h"
+
+namespace json {
+
+	/**
+	 * 	@class		JSONMappedFile
+	 * 	@brief		Own a read-only memory mapping of a whole file
+	 *
+	 * 	Can be moved but not copied, views of the text are valid as long as the
+	 * 	mapping is owned
+	 *
+	 */
+	class JSONMappedFile {
+		public:
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Open and map the file
+			 *
+			 * 	@param	const std::string&		Name of the file, used as is
+			 * 	@throw	  JSONException		  If the file cannot be opened or mapped
+			 *
+			 * 	@version	0.1
+			 */
+			JSONMappedFile(const std::string& filename);
+
+			/// Copying is not allowed, there is only one owner of the mapping
+			JSONMappedFile(const JSONMappedFile& copy) = delete;
+
+			/**
+			 * 	@brief	Move Constructor
+			 *
+			 * 	Take the mapping, leaving the other file empty
+			 *
+			 * 	@version	0.1
+			 */
+			JSONMappedFile(JSONMappedFile&& other);
+
+			/**
+			 * 	@brief	Get the contents of the file
+			 *
+			 * 	@return	std::string_view		The mapped text
+			 */
+			std::string_view getText() const {
+				return std::string_view(this->data, this->length);
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Unmap the file
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONMappedFile();
+
+		protected:
+			/// Start of the mapping, nullptr when the file is empty
+			const char* data;
+
+			/// Size of the file
+			std::size_t length;
+	};
+}
+#endif
@@ -0,0 +1,151 @@
+/**
+ *  @file		json_memory.h
+ *  @brief	  Measure the memory a document uses, and the peak of parsing one
+ *
+ * 	A document is walked and every allocation it owns is added up, split into
+ * 	keys, string payloads and containers, along with a count of each type of
+ * 	value.  Bytes are what was asked of the allocator, its own bookkeeping and
+ * 	rounding are not included.
+ *
+ * 	The peak of a parse can only be seen by counting allocations as they
+ * 	happen, so it needs the library built with TRACK_ALLOCATIONS, which
+ * 	replaces the global operator new and delete with counting ones
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_MEMORY_H
+#define JSON_MEMORY_H
+
+#include <cstddef>
+#include <string_view>
+#include <unordered_set>
+
+#include "jsonable.h"
+
+namespace json {
+	/**
+	 * 	@struct		JSONMemoryUsage
+	 * 	@brief		What a document allocates, by what it is allocated for
+	 *
+	 */
+	struct JSONMemoryUsage {
+		// ----- Bytes -----
+		/// Blocks of long keys, a block shared by several keys counted once
+		std::size_t keyBytes = 0;
+
+		/// Characters of strings too long to be kept in the std::string
+		std::size_t stringBytes = 0;
+
+		/// Members, elements and hash indices of objects and arrays, holding the values themselves
+		std::size_t containerBytes = 0;
+
+		// ----- Counts -----
+		std::size_t objects = 0;
+		std::size_t arrays = 0;
+		std::size_t strings = 0;
+		std::size_t ints = 0;
+		std::size_t int64s = 0;
+		std::size_t uint64s = 0;
+		std::size_t doubles = 0;
+		std::size_t bools = 0;
+		std::size_t nulls = 0;
+
+		/// Members of every object
+		std::size_t keys = 0;
+
+		/// Keys long enough to be held in a block
+		std::size_t sharedKeys = 0;
+
+		/// Every byte the document allocates
+		std::size_t totalBytes() const {
+			return this->keyBytes + this->stringBytes + this->containerBytes;
+		}
+
+		/// Every value, including the objects and arrays
+		std::size_t totalValues() const {
+			return this->objects + this->arrays + this->strings + this->ints + this->int64s +
+					this->uint64s + this->doubles + this->bools + this->nulls;
+		}
+	};
+
+	/**
+	 * 	@struct		JSONParseMemory
+	 * 	@brief		The memory of one parse, while it ran and what it left
+	 *
+	 */
+	struct JSONParseMemory {
+		/// The document the parse built
+		JSONMemoryUsage document;
+
+		/// Most bytes held at once by allocations the parse made
+		std::size_t peakBytes = 0;
+
+		/// Number of allocations the parse made
+		std::size_t allocations = 0;
+	};
+
+	/**
+	 * 	@class		JSONMemory
+	 * 	@brief		A pure static class to measure the memory of documents
+	 *
+	 */
+	class JSONMemory {
+		public:
+			/**
+			 * 	@brief	Add up what a document allocates
+			 *
+			 * 	@param	const JSON&		The document, the object itself included
+			 * 	@return	JSONMemoryUsage		Its bytes and counts
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONMemoryUsage measure(const JSON& j);
+
+			/**
+			 * 	@brief	Add up what a value allocates
+			 *
+			 * 	@param	const JSONValue&		The value, its own size is not counted since
+			 * 	it lives in whatever holds it
+			 * 	@return	JSONMemoryUsage		Its bytes and counts
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONMemoryUsage measure(const JSONValue& value);
+
+			/**
+			 * 	@brief	Parse text with JSONTextParser::parse, counting the allocations it makes
+			 *
+			 * 	@param	std::string_view		The json text
+			 * 	@return	JSONParseMemory		The peak of the parse and the document it built
+			 * 	@throw	  JSONException		  If the text is not valid json, or the library
+			 * 	was built without TRACK_ALLOCATIONS
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONParseMemory measureParse(std::string_view jsonText);
+
+			/// If the library was built to count allocations, see measureParse
+			static bool isTrackingAllocations();
+
+		protected:
+			/**
+			 * 	@brief	Add what a value allocates to a usage
+			 *
+			 * 	@param	const JSONValue&		The value
+			 * 	@param	JSONMemoryUsage&		The usage to add to
+			 * 	@param	std::unordered_set<const void*>&		Long key blocks already counted
+			 *
+			 * 	@version 0.1
+			 */
+			static void measureValue(const JSONValue& value, JSONMemoryUsage& usage,
+					std::unordered_set<const void*>& blocks);
+
+			/// Add what the members of an object allocate to a usage
+			static void measureMembers(const JSON& j, JSONMemoryUsage& usage,
+					std::unordered_set<const void*>& blocks);
+	};
+}
+#endif
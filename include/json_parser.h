@@ -2,31 +2,31 @@
  *  @file		json_parser.h
  *  @brief	  Describes how to build a json string from a JSON object
  *  
- * 	Use Recursive functions, and the visitor pattern,
- *  to go from the JSON object and then to the string
+ * 	Every kind of document is handed to JSONSerializer, which builds the
+ *  text in one buffer
  *  
  *  @author	  Gabriel Shelton	sheltongabe
  *  @date		07-31-2018
- *  @version  0.4
+ *  @version  0.5
  */
 
 #ifndef JSON_PARSER_H
 #define JSON_PARSER_H
 
-#include <sstream>
+#include <string>
 
+#include "json_compact_value.h"
+#include "json_persistent_document.h"
+#include "json_tape.h"
 #include "jsonable.h"
 
 
 namespace json {
-	// Forward declare the struct JSONTextVisitor for the parser
-	struct JSONTextVisitor;
-
 	/**
 	 * 	@class		JSONParser
 	 * 	@brief		A pure static class that describes how to convert objects to json strings
 	 * 
-	 * 	Uses recursive functions to form the json string
+	 * 	Uses JSONSerializer to form the json string
 	 * 
 	 */
 	class JSONParser {
@@ -63,160 +63,85 @@ namespace json {
 			 * 
 			 * 	Call a recursive method that will start to build the JSON string
 			 * 
-			 * 	@param	JSON			JSON object to build the text from
+			 * 	@param	const JSON&			JSON object to build the text from, which is not copied
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.2
+			 */
+			static std::string parse(const JSON& j);
+
+			/**
+			 * 	@brief 	Take a JSON and build a string on a single line, with no whitespace
+			 * 
+			 * 	@param	const JSON&			JSON object to build the text from, which is not copied
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.6
+			 */
+			static std::string parseCompact(const JSON& j);
+
+			/**
+			 * 	@brief 	Take a JSONCompactValue and build a string, formatted like parse
+			 * 
+			 * 	@param	const JSONCompactValue&		Value to build the text from
 			 * 	@return  std::string 	The json string built
 			 * 
 			 * 	@version 0.1
 			 */
-			static std::string parse(JSON j);
+			static std::string parse(const JSONCompactValue& value);
 
 			/**
-			 * 	@brief 	Begin building the text form of an object into a stringstream and visiting as needed
+			 * 	@brief 	Take a JSONCompactValue and build a string on a single line, with no whitespace
 			 * 
-			 * 	Use the visitor pattern to visit and get the type of the variant and act based on the type
-			 * 	retrieved, inserting it into the stringstream and formatting the json, as needed
+			 * 	@param	const JSONCompactValue&		Value to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parseCompact(const JSONCompactValue& value);
+
+			/**
+			 * 	@brief 	Take a JSONPersistentDocument and build a string, formatted like parse
 			 * 
-			 * 	@param	JSON& 				  The object being converted
-			 * 	@param	stringstream& 	The stream that the text is being inserted into
-			 * 	@param	int						  How many tabs are needed before each line
+			 * 	@param	const JSONPersistentDocument&		Version of the document to build the text from
+			 * 	@return  std::string 	The json string built
 			 * 
-			 * 	@version 0.4
+			 * 	@version 0.1
 			 */
-			static void parseObject(JSON& j, std::stringstream& s, int& numTabs);
+			static std::string parse(const JSONPersistentDocument& document);
 
 			/**
-			 * 	@brief 	Begin building the text form of an array into a stringstream and visiting as needed
+			 * 	@brief 	Take a JSONPersistentDocument and build a string on a single line, with no whitespace
 			 * 
-			 * 	Use the visitor pattern to visit and get the type of the variant and act based on the type
-			 * 	retrieved, inserting it into the stringstream and formatting the json, as needed
+			 * 	@param	const JSONPersistentDocument&		Version of the document to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parseCompact(const JSONPersistentDocument& document);
+
+			/**
+			 * 	@brief 	Take a JSONTape and build a string, formatted like parse
 			 * 
-			 * 	@param	JSONArray& 		  The array being converted
-			 * 	@param	stringstream& 	The stream that the text is being inserted into
-			 * 	@param	int						   How many tabs are needed before each line
+			 * 	@param	const JSONTape&		Tape to build the text from
+			 * 	@return  std::string 	The json string built
 			 * 
-			 * 	@version 0.4
+			 * 	@version 0.1
 			 */
-			static void parseArray(JSONArray& j, std::stringstream& s, int& numTabs);
+			static std::string parse(const JSONTape& tape);
 
-		protected:
-			/// Initial number of tabs that is used when performing conversion
-			static int INITIAL_NUM_TABS;
+			/**
+			 * 	@brief 	Take a JSONTape and build a string on a single line, with no whitespace
+			 * 
+			 * 	@param	const JSONTape&		Tape to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parseCompact(const JSONTape& tape);
 
 		private:
 
 	};
-
-	/**
-	 * 	@struct	JSONTextVisitor
-	 * 	@brief 	Define how the JSON object is visited
-	 * 
-	 * 	Overload the callable operator several times, for each type that is visited,
-	 * 	and a general one that takes an auto type for others.
-	 * 
-	 */
-	struct JSONTextVisitor {
-		/// The string stream that is being inserted into
-		std::stringstream& s;
-
-		/// The number of tabs to place before new lines
-		int numTabs;
-
-		/**
-		 * 	@brief 	Initializing Constructor
-		 * 
-		 * 	@param	stringstream	The stream to insert the json text to
-		 * 	@param	int						The number of tabs to place before a newline
-		 * 
-		 * 	@version 0.1
-		 */
-		JSONTextVisitor(std::stringstream& s, int& numTabs) :
-			s(s),
-			numTabs(numTabs) { }
-
-		/**
-		 * 	@brief 	Operator overload for a string case
-		 * 
-		 * 	Insert the string paramater to the string stream, w/ quotes
-		 * 
-		 * 	@param	std::string const&		reference to string object
-		 * 
-		 */
-		void operator()(std::string const& item) {
-			this->s << "\"" << item << "\"";
-		}
-
-		/**
-		 * 	@brief 	Operator overload for a bool case
-		 * 
-		 * 	Insert the bool paramater to the string stream
-		 * 
-		 * 	@param	bool const&		reference to bool object
-		 * 
-		 */
-		void operator()(bool const& item) {
-			std::string itemStr = (item) ? "true" : "false";
-			this->s << itemStr;
-		}
-
-		/**
-		 * 	@brief 	Operator overload for a JSONObject case
-		 * 
-		 * 	
-		 * 
-		 * 	@param	json::JSONObject const&		reference to JSONObject object
-		 * 
-		 */
-		void operator()(JSONObject& item) {
-			// Use existing infrastructure to parse the passed object and insert
-			// it into the string stream
-			json::JSONParser::parseObject(item, this->s, this->numTabs);
-		}
-
-		/**
-		 * 	@brief 	Operator overload for a JSONArray case
-		 * 
-		 * 	
-		 * 
-		 * 	@param	json::JSONArray const&		reference to JSONArray object
-		 * 
-		 */
-		void operator()(JSONArray& item) {
-			// Use existing infrastructure to parse the passed array and insert
-			// it into the string stream
-			json::JSONParser::parseArray(item, this->s, this->numTabs);
-		}
-
-		/**
-		 * 	@brief 	Operator overload for a std::monostate (null)
-		 * 
-		 * 	
-		 * 
-		 * 	@param	std::monostate const&		reference to monostate
-		 * 
-		 */
-		void operator()(std::monostate const& item) {
-			std::string nullString = std::move("null");
-			this->s << nullString;
-		}
-
-		/**
-		 * 	@brief 	Overload for the general case function call
-		 * 
-		 * 	Insert the contents of the paramater to the string stream	
-		 * 
-		 * 	@param	T const&		reference to general object, type is auto determined
-		 * 
-		 */
-		template <typename T>
-		void operator()(T const& item) {
-			// String representation for the item
-			std::string itemStr = std::to_string(item);
-			const char* itemC_Str = itemStr.c_str();
-
-			// Put the item into the stream char-by char
-			for(int i = 0; i < itemStr.length(); ++i)
-				s.put(itemC_Str[i]);
-		}
-	};
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,276 @@
+/**
+ *  @file		json_persistent_document.h
+ *  @brief	  An immutable json document whose versions share every unchanged value
+ *
+ * 	Values are reference counted nodes that are never changed once built.
+ * 	Copying a document (a snapshot) copies one pointer.  Objects are
+ * 	JSONPersistentMaps and arrays JSONPersistentVectors, so an update copies
+ * 	O(log n) nodes of each object and array on the path to the value changed,
+ * 	however wide they are, the new version sharing everything else with the
+ * 	old one.  Snapshots can be handed to other threads, nothing they can reach
+ * 	is ever written again
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_PERSISTENT_DOCUMENT_H
+#define JSON_PERSISTENT_DOCUMENT_H
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "json_exception.h"
+#include "json_key.h"
+#include "json_persistent_map.h"
+#include "json_persistent_vector.h"
+#include "jsonable.h"
+
+namespace json {
+	class JSONPersistentValue;
+
+	/// An object of persistent values, kept in the order the members were added
+	using JSONPersistentObject = JSONPersistentMap<JSONPersistentValue>;
+
+	/// An array of persistent values
+	using JSONPersistentArray = JSONPersistentVector<JSONPersistentValue>;
+
+	/// A step of a path through a document, the key of a member or the index of an element
+	using JSONPathStep = std::variant<JSONKey, std::size_t>;
+
+	/// The steps from the root of a document to one of its values
+	using JSONPath = std::vector<JSONPathStep>;
+
+	/**
+	 * 	@class		JSONPersistentValue
+	 * 	@brief		A shared handle to an immutable json value
+	 *
+	 * 	-Copies share the value, they never copy it
+	 * 	-Scalars are held as a JSONValue, objects and arrays as containers of handles
+	 * 	-Getters throw a JSONException if the value is not of the type asked for
+	 *
+	 */
+	class JSONPersistentValue {
+		public:
+			/// Default Constructor, a null value that allocates nothing
+			JSONPersistentValue() = default;
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Build the value, and every value an object or array in it holds
+			 *
+			 * 	@param	const JSONValue&		The value
+			 *
+			 * 	@version	0.1
+			 */
+			JSONPersistentValue(const JSONValue& value);
+
+			/// Initializing Constructor from anything a JSONValue can be built from
+			template <typename T, typename = std::enable_if_t<
+					std::is_constructible_v<JSONValue, T> &&
+					!std::is_same_v<std::decay_t<T>, JSONValue> &&
+					!std::is_same_v<std::decay_t<T>, JSONPersistentValue>>>
+			JSONPersistentValue(T&& value) : JSONPersistentValue(JSONValue(std::forward<T>(value))) { }
+
+			/// Initializing Constructor, an object of the members given
+			JSONPersistentValue(JSONPersistentObject&& object);
+
+			/// Initializing Constructor, an array of the elements given
+			JSONPersistentValue(JSONPersistentArray&& array);
+
+			// ----- Type checks -----
+			bool isNull() const;
+			bool isObject() const;
+			bool isArray() const;
+			bool isScalar() const { return !this->isObject() && !this->isArray(); }
+
+			// ----- Getters -----
+			/// A value that is not an object or array
+			const JSONValue& getScalar() const;
+			const JSONPersistentObject& getObject() const;
+			const JSONPersistentArray& getArray() const;
+
+			/**
+			 * 	@brief	Check if two handles share the same value
+			 *
+			 * 	@param	const JSONPersistentValue&		The other value
+			 * 	@return	bool		If both point to the same node, nulls all share one
+			 */
+			bool shares(const JSONPersistentValue& other) const {
+				return this->node == other.node;
+			}
+
+			/**
+			 * 	@brief	Build the JSONValue form of the value
+			 *
+			 * 	@return	JSONValue		The same value
+			 *
+			 * 	@version 0.1
+			 */
+			JSONValue toJSONValue() const;
+
+			/**
+			 * 	@brief	Compare with another value the way JSONCompare compares JSONValues
+			 *
+			 * 	Values that share a node are equal without looking at them, so versions
+			 * 	of a document compare in time proportional to what differs
+			 *
+			 * 	@param	const JSONPersistentValue&		The other value
+			 * 	@return	bool		If the values are equal
+			 *
+			 * 	@version 0.1
+			 */
+			bool operator==(const JSONPersistentValue& other) const;
+
+			/// Different values
+			bool operator!=(const JSONPersistentValue& other) const {
+				return !(*this == other);
+			}
+
+		protected:
+			/// What a value holds, never changed once built
+			struct Node;
+
+			/// The value, nullptr for null
+			std::shared_ptr<const Node> node;
+	};
+
+	/// A node holds a scalar, an object or an array
+	struct JSONPersistentValue::Node {
+		std::variant<JSONValue, JSONPersistentObject, JSONPersistentArray> value;
+	};
+
+	/**
+	 * 	@class		JSONPersistentDocument
+	 * 	@brief		A version of an immutable json document
+	 *
+	 * 	Updates return a new version, leaving this one as it was.  Copying is a
+	 * 	snapshot that costs the same no matter the size of the document.
+	 *
+	 */
+	class JSONPersistentDocument {
+		public:
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	An empty object
+			 *
+			 * 	@version	0.1
+			 */
+			JSONPersistentDocument();
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Build a document holding the same values as the JSON
+			 *
+			 * 	@param	const JSON&		The object the document starts as
+			 *
+			 * 	@version	0.1
+			 */
+			JSONPersistentDocument(const JSON& json);
+
+			/// Initializing Constructor, a document with the root given
+			JSONPersistentDocument(const JSONPersistentValue& root) : root(root) { }
+
+			/// Get the value at the root of the document
+			const JSONPersistentValue& getRoot() const {
+				return this->root;
+			}
+
+			/// Take a snapshot of this version, a copy sharing the whole document
+			JSONPersistentDocument snapshot() const {
+				return *this;
+			}
+
+			/**
+			 * 	@brief	Get the value at the end of a path
+			 *
+			 * 	@param	const JSONPath&		Keys and indices from the root
+			 * 	@return	const JSONPersistentValue&		The value
+			 * 	@throw	  JSONException		If the path leads nowhere
+			 *
+			 * 	@version 0.1
+			 */
+			const JSONPersistentValue& get(const JSONPath& path) const;
+
+			/// Get a member of the root object, throw a JSONException if there is none
+			const JSONPersistentValue& operator[](std::string_view key) const;
+
+			/**
+			 * 	@brief	Build the version with the value at the end of a path set
+			 *
+			 * 	-The last key adds the member or replaces its value, the last index
+			 * 	replaces the element or, one past the end, appends
+			 * 	-Only the nodes on the path through each object and array along
+			 * 	the path are copied, O(log n) of them, the rest are shared
+			 *
+			 * 	@param	const JSONPath&		Keys and indices from the root
+			 * 	@param	JSONPersistentValue		The value to put there
+			 * 	@return	JSONPersistentDocument		The new version
+			 * 	@throw	  JSONException		If the path leads nowhere
+			 *
+			 * 	@version 0.1
+			 */
+			JSONPersistentDocument set(const JSONPath& path, JSONPersistentValue value) const;
+
+			/**
+			 * 	@brief	Build the version without the value at the end of a path
+			 *
+			 * 	@param	const JSONPath&		Keys and indices from the root, at least one
+			 * 	@return	JSONPersistentDocument		The new version
+			 * 	@throw	  JSONException		If the path leads nowhere
+			 *
+			 * 	@version 0.1
+			 */
+			JSONPersistentDocument erase(const JSONPath& path) const;
+
+			/**
+			 * 	@brief	Build a JSON holding the same values as the document
+			 *
+			 * 	@return	JSON		The root object
+			 * 	@throw	  JSONException		If the root is not an object
+			 *
+			 * 	@version 0.1
+			 */
+			JSON toJSON() const;
+
+			/// Same values, see JSONPersistentValue::operator==
+			bool operator==(const JSONPersistentDocument& other) const {
+				return this->root == other.root;
+			}
+
+			/// Different values
+			bool operator!=(const JSONPersistentDocument& other) const {
+				return !(*this == other);
+			}
+
+		protected:
+			/// The value at the root, normally an object
+			JSONPersistentValue root;
+
+			/**
+			 * 	@brief	Build a copy of a value with the value at the end of the path replaced
+			 *
+			 * 	@param	const JSONPersistentValue&		Value the path starts from
+			 * 	@param	JSONPath::const_iterator		The next step
+			 * 	@param	JSONPath::const_iterator		The end of the path
+			 * 	@param	JSONPersistentValue*		Value to put at the end, or nullptr to erase it
+			 * 	@return	JSONPersistentValue		The updated copy
+			 * 	@throw	  JSONException		If the path leads nowhere
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONPersistentValue update(const JSONPersistentValue& current,
+					JSONPath::const_iterator step, JSONPath::const_iterator end,
+					JSONPersistentValue* value);
+	};
+}
+#endif
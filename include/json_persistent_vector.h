@@ -0,0 +1,391 @@
+/**
+ *  @file		json_persistent_vector.h
+ *  @brief	  An immutable array whose versions share everything but the path to what changed
+ *
+ * 	Elements sit in the leaves of a trie 32 wide, found by taking the index
+ * 	5 bits at a time from the root down.  Setting, appending or removing the
+ * 	last element copies only the nodes on its path, one per level, so a new
+ * 	version costs O(log n) and shares every other node with the old one.
+ * 	Erasing any other element moves the ones after it, so the trie is built
+ * 	again.  Nodes are never changed once built, versions can be read from any
+ * 	thread
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_PERSISTENT_VECTOR_H
+#define JSON_PERSISTENT_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace json {
+
+	/**
+	 * 	@class		JSONPersistentVector
+	 * 	@brief		An immutable array of T, updates return a new version
+	 *
+	 * 	-Copies share the whole trie, they never copy it
+	 * 	-References to elements stay valid while any version holding them does
+	 * 	-Comparing with == skips the nodes two versions share
+	 *
+	 */
+	template <typename T>
+	class JSONPersistentVector {
+		protected:
+			/// A level of the trie, a branch holds children and a leaf holds elements
+			struct Node {
+				std::vector<std::shared_ptr<const Node>> children;
+				std::vector<T> values;
+			};
+
+		public:
+			using value_type = T;
+			using size_type = std::size_t;
+
+			/// Bits of the index taken at each level
+			static constexpr size_type BITS = 5;
+
+			/// Children of a branch, elements of a leaf
+			static constexpr size_type WIDTH = size_type(1) << BITS;
+
+			/**
+			 * 	@class		const_iterator
+			 * 	@brief		Walk the elements in order, finding each leaf once
+			 *
+			 */
+			class const_iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = T;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const T*;
+					using reference = const T&;
+
+					/// Default Constructor, an iterator of no vector
+					const_iterator() :
+						vector(nullptr),
+						index(0),
+						leaf(nullptr) { }
+
+					/// Initializing Constructor, the element at an index, or the end past the last one
+					const_iterator(const JSONPersistentVector* vector, size_type index) :
+						vector(vector),
+						index(index),
+						leaf((index < vector->size()) ? vector->findLeaf(index) : nullptr) { }
+
+					reference operator*() const { return this->leaf->values[this->index & (WIDTH - 1)]; }
+					pointer operator->() const { return &**this; }
+
+					/// Step to the next element, looking up the next leaf at the end of one
+					const_iterator& operator++() {
+						++this->index;
+						if((this->index & (WIDTH - 1)) == 0)
+							this->leaf = (this->index < this->vector->size()) ? this->vector->findLeaf(this->index) : nullptr;
+						return *this;
+					}
+
+					const_iterator operator++(int) {
+						const_iterator previous = *this;
+						++*this;
+						return previous;
+					}
+
+					bool operator==(const const_iterator& other) const { return this->index == other.index; }
+					bool operator!=(const const_iterator& other) const { return this->index != other.index; }
+
+					/// The index of the element
+					size_type getIndex() const {
+						return this->index;
+					}
+
+				protected:
+					/// The vector walked
+					const JSONPersistentVector* vector;
+
+					/// The index of the element
+					size_type index;
+
+					/// The leaf holding the element
+					const Node* leaf;
+			};
+
+			/// Default Constructor, an empty vector
+			JSONPersistentVector() :
+				count(0),
+				shift(0) { }
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	The trie is built from the leaves up, so building it costs O(n) and
+			 * 	copies no path
+			 *
+			 * 	@param	std::vector<T>		The elements, in order
+			 *
+			 * 	@version	0.1
+			 */
+			explicit JSONPersistentVector(std::vector<T> elements) :
+					count(elements.size()),
+					shift(0) {
+				if(elements.empty())
+					return;
+
+				std::vector<std::shared_ptr<const Node>> level;
+				level.reserve((elements.size() + WIDTH - 1) / WIDTH);
+				for(size_type first = 0; first < elements.size(); first += WIDTH) {
+					auto leaf = std::make_shared<Node>();
+					leaf->values.assign(std::make_move_iterator(elements.begin() + first),
+							std::make_move_iterator(elements.begin() + std::min(first + WIDTH, elements.size())));
+					level.push_back(std::move(leaf));
+				}
+
+				// Each level up holds the nodes of the one below, WIDTH to a branch
+				while(level.size() > 1) {
+					std::vector<std::shared_ptr<const Node>> parents;
+					parents.reserve((level.size() + WIDTH - 1) / WIDTH);
+					for(size_type first = 0; first < level.size(); first += WIDTH) {
+						auto branch = std::make_shared<Node>();
+						branch->children.assign(level.begin() + first, level.begin() + std::min(first + WIDTH, level.size()));
+						parents.push_back(std::move(branch));
+					}
+					level.swap(parents);
+					this->shift += BITS;
+				}
+				this->root = std::move(level.front());
+			}
+
+			// ----- Iteration, in order -----
+			const_iterator begin() const { return const_iterator(this, 0); }
+			const_iterator end() const { return const_iterator(this, this->count); }
+
+			/// Number of elements
+			size_type size() const { return this->count; }
+
+			/// If there are no elements
+			bool empty() const { return this->count == 0; }
+
+			/// Get the element at an index, which must be less than size()
+			const T& operator[](size_type index) const {
+				return this->findLeaf(index)->values[index & (WIDTH - 1)];
+			}
+
+			/// Get the last element, there must be one
+			const T& back() const {
+				return (*this)[this->count - 1];
+			}
+
+			/**
+			 * 	@brief	Build the version with the element at an index replaced
+			 *
+			 * 	@param	size_type		The index, less than size()
+			 * 	@param	T		The element to put there
+			 * 	@return	JSONPersistentVector		The new version
+			 *
+			 * 	@version 0.1
+			 */
+			JSONPersistentVector set(size_type index, T value) const {
+				JSONPersistentVector result = *this;
+				result.root = JSONPersistentVector::assign(this->root.get(), this->shift, index, std::move(value));
+				return result;
+			}
+
+			/**
+			 * 	@brief	Build the version with an element added after the last one
+			 *
+			 * 	A full trie grows a level, its root becoming the first child of the new one
+			 *
+			 * 	@param	T		The element
+			 * 	@return	JSONPersistentVector		The new version
+			 *
+			 * 	@version 0.1
+			 */
+			JSONPersistentVector append(T value) const {
+				JSONPersistentVector result = *this;
+				if(this->root && this->count == (size_type(1) << (this->shift + BITS))) {
+					auto grown = std::make_shared<Node>();
+					grown->children.push_back(this->root);
+					result.root = std::move(grown);
+					result.shift += BITS;
+				}
+
+				result.root = JSONPersistentVector::assign(result.root.get(), result.shift, this->count, std::move(value));
+				++result.count;
+				return result;
+			}
+
+			/**
+			 * 	@brief	Build the version without the element at an index
+			 *
+			 * 	The last element is removed by copying its path, any other by building
+			 * 	the trie again from the elements left
+			 *
+			 * 	@param	size_type		The index, less than size()
+			 * 	@return	JSONPersistentVector		The new version
+			 *
+			 * 	@version 0.1
+			 */
+			JSONPersistentVector erase(size_type index) const {
+				if(index + 1 != this->count) {
+					std::vector<T> elements;
+					elements.reserve(this->count - 1);
+					for(const_iterator current = this->begin(); current != this->end(); ++current) {
+						if(current.getIndex() != index)
+							elements.push_back(*current);
+					}
+					return JSONPersistentVector(std::move(elements));
+				}
+
+				JSONPersistentVector result;
+				result.root = JSONPersistentVector::removeLast(this->root.get(), this->shift, index);
+				result.count = this->count - 1;
+				result.shift = this->shift;
+
+				// A root left with one child is replaced by it
+				while(result.shift > 0 && result.root->children.size() == 1) {
+					result.root = result.root->children.front();
+					result.shift -= BITS;
+				}
+				return result;
+			}
+
+			/**
+			 * 	@brief	Check every pair of elements at the same index, skipping the nodes both share
+			 *
+			 * 	@param	const JSONPersistentVector&		The other vector
+			 * 	@param	Same		Called with an element of each, true if they match
+			 * 	@return	bool		If both are the same size and every pair matches
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename Same>
+			bool matches(const JSONPersistentVector& other, Same same) const {
+				if(this->count != other.count)
+					return false;
+				if(this->shift == other.shift)
+					return JSONPersistentVector::matchNodes(this->root.get(), other.root.get(), this->shift, same);
+
+				for(const_iterator left = this->begin(), right = other.begin(); left != this->end(); ++left, ++right) {
+					if(!same(*left, *right))
+						return false;
+				}
+				return true;
+			}
+
+			/// Same elements in the same order
+			bool operator==(const JSONPersistentVector& other) const {
+				return this->matches(other, [](const T& left, const T& right) { return left == right; });
+			}
+
+			/// Differing elements
+			bool operator!=(const JSONPersistentVector& other) const {
+				return !(*this == other);
+			}
+
+		protected:
+			/// The top of the trie, nullptr when empty
+			std::shared_ptr<const Node> root;
+
+			/// Number of elements
+			size_type count;
+
+			/// Bits below the root's level, 0 when the root is a leaf
+			size_type shift;
+
+			/// Find the leaf holding the element at an index
+			const Node* findLeaf(size_type index) const {
+				const Node* node = this->root.get();
+				for(size_type level = this->shift; level > 0; level -= BITS)
+					node = node->children[(index >> level) & (WIDTH - 1)].get();
+				return node;
+			}
+
+			/**
+			 * 	@brief	Copy the path to an index, with the element there replaced or added
+			 *
+			 * 	@param	const Node*		Node the path starts at, nullptr to start a new one
+			 * 	@param	size_type		Bits below the node's level
+			 * 	@param	size_type		The index
+			 * 	@param	T&&		The element
+			 * 	@return	std::shared_ptr<const Node>		The copy of the node
+			 *
+			 * 	@version 0.1
+			 */
+			static std::shared_ptr<const Node> assign(const Node* node, size_type shift, size_type index, T&& value) {
+				auto copy = (node != nullptr) ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+				const size_type slot = (index >> shift) & (WIDTH - 1);
+				if(shift == 0) {
+					if(slot == copy->values.size())
+						copy->values.push_back(std::move(value));
+					else
+						copy->values[slot] = std::move(value);
+					return copy;
+				}
+
+				const Node* child = (slot < copy->children.size()) ? copy->children[slot].get() : nullptr;
+				std::shared_ptr<const Node> updated = JSONPersistentVector::assign(child, shift - BITS, index, std::move(value));
+				if(slot == copy->children.size())
+					copy->children.push_back(std::move(updated));
+				else
+					copy->children[slot] = std::move(updated);
+				return copy;
+			}
+
+			/// Copy the path to the last element, at an index, without it, nullptr for a node left empty
+			static std::shared_ptr<const Node> removeLast(const Node* node, size_type shift, size_type index) {
+				if(shift == 0) {
+					if(node->values.size() == 1)
+						return nullptr;
+					auto copy = std::make_shared<Node>(*node);
+					copy->values.pop_back();
+					return copy;
+				}
+
+				// The last element is under the last child
+				std::shared_ptr<const Node> child = JSONPersistentVector::removeLast(node->children.back().get(), shift - BITS, index);
+				if(!child && node->children.size() == 1)
+					return nullptr;
+
+				auto copy = std::make_shared<Node>(*node);
+				if(child)
+					copy->children.back() = std::move(child);
+				else
+					copy->children.pop_back();
+				return copy;
+			}
+
+			/// Check the elements under two nodes of the same level pair by pair, a shared node matches itself
+			template <typename Same>
+			static bool matchNodes(const Node* left, const Node* right, size_type shift, Same& same) {
+				if(left == right)
+					return true;
+				if(left == nullptr || right == nullptr)
+					return false;
+
+				if(shift == 0) {
+					if(left->values.size() != right->values.size())
+						return false;
+					for(size_type i = 0; i < left->values.size(); ++i) {
+						if(!same(left->values[i], right->values[i]))
+							return false;
+					}
+					return true;
+				}
+
+				if(left->children.size() != right->children.size())
+					return false;
+				for(size_type i = 0; i < left->children.size(); ++i) {
+					if(!JSONPersistentVector::matchNodes(left->children[i].get(), right->children[i].get(), shift - BITS, same))
+						return false;
+				}
+				return true;
+			}
+	};
+}
+#endif
@@ -0,0 +1,269 @@
+/**
+ *  @file		json_pointer.h
+ *  @brief	  RFC 6901 JSON Pointers compiled once into tokens, and an index of hot paths
+ *
+ * 	A pointer such as /config/limits/maxConnections is split and unescaped
+ * 	('~1' is '/', '~0' is '~') once, when it is built.  Each token keeps its
+ * 	key with the key's hash and, if it is one, its array index, so following
+ * 	the pointer through a document never parses or hashes text.
+ *
+ * 	A JSONPathIndex remembers where pointers lead in one document, so looking
+ * 	up a hot path again is a single hash table probe
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_POINTER_H
+#define JSON_POINTER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "json_exception.h"
+#include "json_key.h"
+#include "jsonable.h"
+
+namespace json {
+	/**
+	 * 	@class		JSONPointer
+	 * 	@brief		A JSON Pointer, compiled into the tokens it steps through
+	 *
+	 * 	-The empty pointer refers to the whole document
+	 * 	-A token steps into an object by key, or into an array by index ("-",
+	 * 	past the end of an array, never refers to a value)
+	 *
+	 */
+	class JSONPointer {
+		public:
+			/// Index of a token that is not an array index
+			static constexpr std::size_t NO_INDEX = static_cast<std::size_t>(-1);
+
+			/**
+			 * 	@struct		Token
+			 * 	@brief		One step of the pointer
+			 *
+			 */
+			struct Token {
+				/// The unescaped key
+				JSONKey key;
+
+				/// Hash of key
+				std::size_t hash;
+
+				/// The key as an array index, or NO_INDEX if it is not one
+				std::size_t index;
+			};
+
+			/// Default Constructor, the pointer to the whole document
+			JSONPointer() : hash(std::hash<std::string>{}(std::string())) { }
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	@param	std::string_view		The pointer, "" or a '/' before each token
+			 * 	@throw	  JSONException		  If the pointer is not a valid JSON Pointer
+			 *
+			 * 	@version	0.1
+			 */
+			JSONPointer(std::string_view pointer);
+
+			/// Initializing Constructor from a c string
+			JSONPointer(const char* pointer) : JSONPointer(std::string_view(pointer)) { }
+
+			/// Get the pointer as it was written
+			const std::string& str() const {
+				return this->text;
+			}
+
+			/// Get the tokens, in order from the root
+			const std::vector<Token>& getTokens() const {
+				return this->tokens;
+			}
+
+			/// Get the hash of the whole pointer
+			std::size_t getHash() const {
+				return this->hash;
+			}
+
+			/// If the pointer refers to the whole document
+			bool isRoot() const {
+				return this->tokens.empty();
+			}
+
+			/**
+			 * 	@brief	Find the value the pointer refers to
+			 *
+			 * 	@param	const JSONValue&		The whole document
+			 * 	@return	const JSONValue*		The value, or nullptr if there is none
+			 *
+			 * 	@version 0.1
+			 */
+			const JSONValue* find(const JSONValue& root) const;
+
+			/// Find the value the pointer refers to, or nullptr if there is none
+			JSONValue* find(JSONValue& root) const {
+				return const_cast<JSONValue*>(this->find(static_cast<const JSONValue&>(root)));
+			}
+
+			/**
+			 * 	@brief	Find the value the pointer refers to in an object
+			 *
+			 * 	@param	const JSON&		The whole document
+			 * 	@return	const JSONValue*		The value, or nullptr if there is none or the
+			 * 	pointer is the root, which is not a JSONValue
+			 *
+			 * 	@version 0.1
+			 */
+			const JSONValue* find(const JSON& j) const;
+
+			/// Find the value the pointer refers to in an object, or nullptr if there is none
+			JSONValue* find(JSON& j) const {
+				return const_cast<JSONValue*>(this->find(static_cast<const JSON&>(j)));
+			}
+
+			/**
+			 * 	@brief	Get the value the pointer refers to in an object
+			 *
+			 * 	@param	const JSON&		The whole document
+			 * 	@return	const JSONValue&		The value
+			 * 	@throw	  JSONException		  If the pointer leads nowhere, or is the root
+			 *
+			 * 	@version 0.1
+			 */
+			const JSONValue& get(const JSON& j) const;
+
+			/// Get the value the pointer refers to in an object, throw a JSONException if there is none
+			JSONValue& get(JSON& j) const {
+				return const_cast<JSONValue&>(this->get(static_cast<const JSON&>(j)));
+			}
+
+			/// Pointers are equal if they were written the same
+			bool operator==(const JSONPointer& other) const {
+				return this->hash == other.hash && this->text == other.text;
+			}
+
+			/// Pointers that were written differently
+			bool operator!=(const JSONPointer& other) const {
+				return !(*this == other);
+			}
+
+			/// Hashes a pointer by its stored hash
+			struct Hash {
+				std::size_t operator()(const JSONPointer& pointer) const {
+					return pointer.getHash();
+				}
+			};
+
+		protected:
+			/// The pointer as written
+			std::string text;
+
+			/// Hash of text
+			std::size_t hash;
+
+			/// The steps from the root
+			std::vector<Token> tokens;
+
+			/**
+			 * 	@brief	Take one step from a value
+			 *
+			 * 	@param	const JSONValue&		The object or array to step into
+			 * 	@param	const Token&		The step
+			 * 	@return	const JSONValue*		The member or element, or nullptr if there is none
+			 *
+			 * 	@version 0.1
+			 */
+			static const JSONValue* step(const JSONValue& value, const Token& token);
+
+			/// Take one step into an object, nullptr if it has no such member
+			static const JSONValue* step(const JSON& j, const Token& token);
+	};
+
+	/**
+	 * 	@class		JSONPathIndex
+	 * 	@brief		Where a set of pointers lead in one document
+	 *
+	 * 	Pointers are followed when added, later lookups only probe the index.
+	 * 	The values are found by address, so any change to the document's
+	 * 	objects or arrays can move them, after which rebuild must be called.
+	 *
+	 */
+	class JSONPathIndex {
+		public:
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	@param	JSON&		The document, which must outlive the index
+			 *
+			 * 	@version	0.1
+			 */
+			JSONPathIndex(JSON& document);
+
+			/**
+			 * 	@brief	Follow a pointer and remember where it led
+			 *
+			 * 	@param	const JSONPointer&		The pointer
+			 * 	@return	JSONValue*		The value, or nullptr if there is none
+			 *
+			 * 	@version 0.1
+			 */
+			JSONValue* add(const JSONPointer& pointer);
+
+			/**
+			 * 	@brief	Find the value of a pointer, following it and adding it first if it is new
+			 *
+			 * 	@param	const JSONPointer&		The pointer
+			 * 	@return	JSONValue*		The value, or nullptr if there is none
+			 *
+			 * 	@version 0.1
+			 */
+			JSONValue* find(const JSONPointer& pointer);
+
+			/// Get the value of a pointer, throw a JSONException if there is none
+			JSONValue& get(const JSONPointer& pointer) {
+				JSONValue* value = this->find(pointer);
+				if(value == nullptr)
+					throw JSONException("No json value at the pointer: " + pointer.str());
+				return *value;
+			}
+
+			/// Number of pointers indexed
+			std::size_t size() const {
+				return this->values.size();
+			}
+
+			/**
+			 * 	@brief	Follow every indexed pointer again, after the document changed
+			 *
+			 * 	@version 0.1
+			 */
+			void rebuild();
+
+			/// Forget every pointer
+			void clear() {
+				this->values.clear();
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONPathIndex();
+
+		protected:
+			/// The document the values are in
+			JSON& document;
+
+			/// Where each pointer led, nullptr if nowhere
+			std::unordered_map<JSONPointer, JSONValue*, JSONPointer::Hash> values;
+	};
+}
+#endif
@@ -0,0 +1,459 @@
+/**
+ *  @file		json_serializer.h
+ *  @brief	  Write json text into one contiguous buffer, or through it to a sink
+ *
+ * 	The text is appended to a std::string that keeps its room between
+ * 	documents.  Numbers are formatted on the stack and copied in whole, doubles
+ * 	in the fewest digits that read back as the same value, and in
+ * 	pretty mode each line break and its indentation is copied at once out of
+ * 	one precomputed string.  Strings are escaped by JSONString, which copies
+ * 	the runs between escapes in whole.  Given a JSONSink, the buffer is
+ * 	handed to the sink whenever it fills past FLUSH_SIZE, so a document of
+ * 	any size is written in fixed memory.
+ *
+ * 	writeParallel splits a large top level object or array into chunks of
+ * 	members, each formatted into its own buffer on a JSONThreadPool, and
+ * 	appends or hands them to the sink in order.  The text is the same as
+ * 	write's.
+ *
+ * 	Compact, persistent and tape values are written by the same code through
+ * 	their getters, so each of them gives the same text as its JSONValue would.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_SERIALIZER_H
+#define JSON_SERIALIZER_H
+
+#include <charconv>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json_thread_pool.h"
+#include "jsonable.h"
+
+namespace json {
+	// Forward declare the persistent value, whose scalars are written as the JSONValue they hold
+	class JSONPersistentValue;
+
+	/**
+	 * 	@class		JSONSink
+	 * 	@brief		Overloaded by the client to take text as a JSONSerializer writes it
+	 *
+	 */
+	class JSONSink {
+		public:
+			/**
+			 * 	@brief	Take the next piece of text
+			 *
+			 * 	@param	const char*		Start of the text, only valid during the call
+			 * 	@param	std::size_t		Number of characters
+			 */
+			virtual void write(const char* data, std::size_t length) = 0;
+
+			/**
+			 * 	@brief	Take several pieces of text, in order
+			 *
+			 * 	Each piece is handed to write, a sink that can take them all in one
+			 * 	call overrides this
+			 *
+			 * 	@param	const std::string_view*		The pieces, only valid during the call
+			 * 	@param	std::size_t		Number of pieces
+			 */
+			virtual void writePieces(const std::string_view* pieces, std::size_t count) {
+				for(std::size_t i = 0; i < count; ++i)
+					this->write(pieces[i].data(), pieces[i].size());
+			}
+
+			/// Destructor
+			virtual ~JSONSink() { }
+	};
+
+	/**
+	 * 	@class		JSONStreamSink
+	 * 	@brief		A JSONSink that writes to a std::ostream
+	 *
+	 */
+	class JSONStreamSink : public JSONSink {
+		public:
+			/// Initializing Constructor, the stream must outlive the sink
+			JSONStreamSink(std::ostream& stream) : stream(stream) { }
+
+			/// Write the text to the stream
+			virtual void write(const char* data, std::size_t length) override {
+				this->stream.write(data, length);
+			}
+
+		protected:
+			/// The stream written to
+			std::ostream& stream;
+	};
+
+	/**
+	 * 	@class		JSONSerializer
+	 * 	@brief		Build json text from documents, compact or pretty
+	 *
+	 * 	-Compact text has no whitespace at all
+	 * 	-Pretty text puts each member and element on its own line, indented by
+	 * 	the indent string once per level, the same layout JSONParser::parse uses
+	 * 	A serializer is meant to be kept and reused, it is not thread safe.
+	 *
+	 */
+	class JSONSerializer {
+		public:
+			/// Text is handed to a sink once the buffer holds at least this many characters
+			static std::size_t FLUSH_SIZE;
+
+			/// Room serialize starts the text with
+			static std::size_t INITIAL_SIZE;
+
+			/// Containers with fewer members than this are written serially by writeParallel
+			static std::size_t PARALLEL_THRESHOLD;
+
+			/// Most members formatted into one chunk, bounding the text waiting for the sink
+			static std::size_t PARALLEL_CHUNK_SIZE;
+
+			/// Room formatDouble needs to write any double
+			static constexpr std::size_t DOUBLE_SIZE = 32;
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Text stays in the buffer until it is taken
+			 *
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@param	std::string		Indentation of one level in pretty text
+			 *
+			 * 	@version	0.1
+			 */
+			JSONSerializer(bool compact = false, std::string indent = "\t");
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Text is handed to the sink as the buffer fills, and by flush, which
+			 * 	must be called after the last write
+			 *
+			 * 	@param	JSONSink&		The sink, which must outlive the serializer
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@param	std::string		Indentation of one level in pretty text
+			 *
+			 * 	@version	0.1
+			 */
+			JSONSerializer(JSONSink& sink, bool compact = false, std::string indent = "\t");
+
+			/**
+			 * 	@brief	Append the text of an object
+			 *
+			 * 	@param	const JSON&		The object
+			 *
+			 * 	@version 0.1
+			 */
+			void write(const JSON& j);
+
+			/**
+			 * 	@brief	Append the text of any value
+			 *
+			 * 	@param	const JSONValue&		The value
+			 *
+			 * 	@version 0.1
+			 */
+			void write(const JSONValue& value);
+
+			/**
+			 * 	@brief	Append the text of a compact, persistent or tape value
+			 *
+			 * 	Any value with isObject, isArray, getObject and getArray is written, its
+			 * 	objects holding members of a key and a value.  Scalars are read with
+			 * 	isNull, isBool, isString, isInteger and the getters, or for a persistent
+			 * 	value from the JSONValue of getScalar
+			 *
+			 * 	@param	const Value&		The value
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename Value, typename = decltype(std::declval<const Value&>().isObject())>
+			void write(const Value& value) {
+				this->writeTree(value, 0);
+				this->flushIfFull();
+			}
+
+			/**
+			 * 	@brief	Append the text of an object, formatting its members in parallel
+			 *
+			 * 	-The members are split into chunks, each formatted into its own buffer on the pool
+			 * 	-Chunks are appended, or handed to the sink together, in order as they finish
+			 * 	-Objects under PARALLEL_THRESHOLD members are written serially
+			 * 	-Must not be called from a task of the same pool
+			 *
+			 * 	@param	const JSON&		The object, which must not change until this returns
+			 * 	@param	JSONThreadPool&		Pool the members are formatted on
+			 *
+			 * 	@version 0.1
+			 */
+			void writeParallel(const JSON& j, JSONThreadPool& pool = JSONThreadPool::getShared());
+
+			/**
+			 * 	@brief	Append the text of any value, formatting a top level object's or array's members in parallel
+			 *
+			 * 	@param	const JSONValue&		The value, which must not change until this returns
+			 * 	@param	JSONThreadPool&		Pool the members are formatted on
+			 *
+			 * 	@version 0.1
+			 */
+			void writeParallel(const JSONValue& value, JSONThreadPool& pool = JSONThreadPool::getShared());
+
+			/// Append raw text, such as a separator between documents
+			void writeRaw(std::string_view text) {
+				this->buffer.append(text.data(), text.size());
+				this->flushIfFull();
+			}
+
+			/// Get the text in the buffer, everything written if there is no sink
+			std::string_view getText() const {
+				return this->buffer;
+			}
+
+			/// Take the text in the buffer, leaving it empty
+			std::string takeText() {
+				std::string text;
+				text.swap(this->buffer);
+				return text;
+			}
+
+			/// Empty the buffer, keeping its room for the next text
+			void clear() {
+				this->buffer.clear();
+			}
+
+			/**
+			 * 	@brief	Hand the text in the buffer to the sink, and empty it
+			 *
+			 * 	Does nothing without a sink
+			 *
+			 * 	@version 0.1
+			 */
+			void flush();
+
+			/**
+			 * 	@brief	Build the text of an object
+			 *
+			 * 	@param	const JSON&		The object
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@return	std::string		The text
+			 *
+			 * 	@version 0.1
+			 */
+			static std::string serialize(const JSON& j, bool compact = false);
+
+			/**
+			 * 	@brief	Build the text of a compact, persistent or tape value
+			 *
+			 * 	@param	const Value&		The value
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@return	std::string		The text
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename Value, typename = decltype(std::declval<const Value&>().isObject())>
+			static std::string serialize(const Value& value, bool compact = false) {
+				JSONSerializer serializer(compact);
+				serializer.buffer.reserve(JSONSerializer::INITIAL_SIZE);
+				serializer.write(value);
+				return serializer.takeText();
+			}
+
+			/**
+			 * 	@brief	Build the text of an object, formatting its members in parallel
+			 *
+			 * 	@param	const JSON&		The object
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@param	JSONThreadPool&		Pool the members are formatted on
+			 * 	@return	std::string		The text, the same as serialize's
+			 *
+			 * 	@version 0.1
+			 */
+			static std::string serializeParallel(const JSON& j, bool compact = false,
+					JSONThreadPool& pool = JSONThreadPool::getShared());
+
+			/**
+			 * 	@brief	Write the shortest text that reads back as exactly the same double
+			 *
+			 * 	Whole numbers get a ".0" so they read back as a double and not an
+			 * 	integer.  The text does not depend on the locale.  Json has no text
+			 * 	for NaN or infinity, so they throw rather than write text no parser
+			 * 	reads back; every serializer and writer formats doubles through here
+			 *
+			 * 	@param	double		The value
+			 * 	@param	char*		Where to write, with room for DOUBLE_SIZE characters
+			 * 	@return	std::size_t		Number of characters written
+			 * 	@throw	  JSONException		If the value is NaN or infinite
+			 *
+			 * 	@version 0.1
+			 */
+			static std::size_t formatDouble(double value, char* out);
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONSerializer();
+
+		protected:
+			/// The text not yet taken or handed to the sink
+			std::string buffer;
+
+			/// Where full buffers go, or nullptr to keep everything in the buffer
+			JSONSink* sink;
+
+			/// If there is no whitespace
+			bool compact;
+
+			/// One level of indentation
+			std::string indent;
+
+			/// A line break followed by the indentation of the deepest level reached so far,
+			/// the line break of a depth is the start of it
+			std::string newlines;
+
+			/// Hand the buffer to the sink if it has filled
+			void flushIfFull() {
+				if(this->sink != nullptr && this->buffer.size() >= JSONSerializer::FLUSH_SIZE)
+					this->flush();
+			}
+
+			/// Start a new line at a depth
+			void newline(std::size_t depth);
+
+			/**
+			 * 	@brief	Append the text of an object's members
+			 *
+			 * 	@param	const JSON&		The object
+			 * 	@param	std::size_t		Depth of the object, 0 for the outermost
+			 *
+			 * 	@version 0.1
+			 */
+			void writeObject(const JSON& j, std::size_t depth);
+
+			/// Append the text of an array at a depth
+			void writeArray(const JSONArray& array, std::size_t depth);
+
+			/// Append the members first to last of an object at a depth, each after its separator
+			void writeMembers(const JSON& j, std::size_t first, std::size_t last, std::size_t depth);
+
+			/// Append the elements first to last of an array at a depth, each after its separator
+			void writeElements(const JSONArray& array, std::size_t first, std::size_t last, std::size_t depth);
+
+			/**
+			 * 	@brief	Append a container of the outermost depth, its members formatted in chunks on a pool
+			 *
+			 * 	@param	std::size_t		Number of members
+			 * 	@param	char		The opening bracket
+			 * 	@param	char		The closing bracket
+			 * 	@param	const std::function<...>&		Appends members first to last to a serializer,
+			 * 	the same as writeMembers or writeElements
+			 * 	@param	JSONThreadPool&		Pool the chunks are formatted on
+			 *
+			 * 	@version 0.1
+			 */
+			void writeChunks(std::size_t numMembers, char open, char close,
+					const std::function<void(JSONSerializer&, std::size_t, std::size_t)>& writeRange,
+					JSONThreadPool& pool);
+
+			/// Append finished chunks, or hand them to the sink after the buffer
+			void appendChunks(std::vector<std::string>& chunks);
+
+			/// Append the text of a value at a depth
+			void writeValue(const JSONValue& value, std::size_t depth);
+
+			/// Append a quoted string, escaping the characters that need it
+			void writeString(std::string_view s);
+
+			/**
+			 * 	@brief	Append the text of a compact, persistent or tape value at a depth
+			 *
+			 * 	Objects and arrays are laid out the same as writeObject and writeArray
+			 * 	lay them out
+			 *
+			 * 	@param	const Value&		The value
+			 * 	@param	std::size_t		Depth of the value, 0 for the outermost
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename Value>
+			void writeTree(const Value& value, std::size_t depth) {
+				const bool isObject = value.isObject();
+				if(!isObject && !value.isArray())
+					return this->writeScalar(value);
+
+				this->buffer += isObject ? '{' : '[';
+				std::size_t count = 0;
+				if(isObject) {
+					for(const auto& member : value.getObject()) {
+						if(count++ != 0)
+							this->buffer += ',';
+						if(!this->compact)
+							this->newline(depth + 1);
+
+						this->writeString(member.first);
+						this->buffer.append(this->compact ? ":" : " : ");
+						this->writeTree(member.second, depth + 1);
+						this->flushIfFull();
+					}
+				}
+				else {
+					for(const auto& element : value.getArray()) {
+						if(count++ != 0)
+							this->buffer += ',';
+						if(!this->compact)
+							this->newline(depth + 1);
+
+						this->writeTree(element, depth + 1);
+						this->flushIfFull();
+					}
+				}
+
+				if(!this->compact)
+					this->newline(depth);
+				this->buffer += isObject ? '}' : ']';
+			}
+
+			/// Append a value that is not an object or array, the same text its JSONValue gets
+			template <typename Value>
+			void writeScalar(const Value& value) {
+				if constexpr(std::is_same_v<Value, JSONPersistentValue>) {
+					this->writeValue(value.getScalar(), 0);
+				}
+				else {
+					char digits[JSONSerializer::DOUBLE_SIZE];
+					if(value.isNull())
+						this->buffer.append("null");
+					else if(value.isBool())
+						this->buffer.append(value.getBool() ? "true" : "false");
+					else if(value.isString())
+						this->writeString(value.getString());
+					else if(value.isInteger()) {
+						// Negative integers fit an int64_t, the rest a uint64_t
+						const std::to_chars_result written = (value.getDouble() < 0) ?
+								std::to_chars(digits, digits + sizeof(digits), value.getInt64()) :
+								std::to_chars(digits, digits + sizeof(digits), value.getUint64());
+						this->buffer.append(digits, written.ptr - digits);
+					}
+					else
+						this->buffer.append(digits, JSONSerializer::formatDouble(value.getDouble(), digits));
+				}
+			}
+	};
+}
+#endif
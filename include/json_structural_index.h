@@ -0,0 +1,162 @@
+/**
+ *  @file		json_structural_index.h
+ *  @brief	  Find where every token of a json text starts, 64 bytes at a time
+ *
+ * 	The first stage of parsing large texts, the positions of the structural
+ * 	characters { } [ ] : , of both quotes of each string, and of the first
+ * 	character of each bare value are collected so a JSONCursor can jump
+ * 	between them instead of testing each byte
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_STRUCTURAL_INDEX_H
+#define JSON_STRUCTURAL_INDEX_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace json {
+
+	/**
+	 * 	@class		JSONStructuralIndex
+	 * 	@brief		An ordered list of the offsets where each token in a text begins
+	 *
+	 * 	The text is scanned in blocks of 64 bytes by the best kernel the cpu
+	 * 	supports (AVX2, SSE4.2 or a portable scalar loop), picked once at runtime.
+	 * 	Escaped quotes and everything inside of strings are masked out.
+	 *
+	 */
+	class JSONStructuralIndex {
+		public:
+			/// The kind of kernel used to scan a block
+			enum Kernel {
+				SCALAR = 0,
+				SSE42 = 1,
+				AVX2 = 2
+			};
+
+			/// Bitmasks of the characters in a 64 byte block, bit i describes byte i
+			struct BlockMasks {
+				uint64_t quote;
+				uint64_t singleQuote;
+				uint64_t backslash;
+				uint64_t op;
+				uint64_t whitespace;
+			};
+
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	Build an empty, invalid index
+			 *
+			 * 	@version	0.1
+			 */
+			JSONStructuralIndex();
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Build the index for the text passed
+			 *
+			 * 	@param	std::string_view		The text to index
+			 *
+			 * 	@version	0.1
+			 */
+			JSONStructuralIndex(std::string_view text);
+
+			/**
+			 * 	@brief	(Re)build the index for the text passed, keeping the allocated buffer
+			 *
+			 * 	@param	std::string_view		The text to index
+			 * 	@return   bool						  If the index is usable for the text
+			 *
+			 * 	@version 0.1
+			 */
+			bool build(std::string_view text);
+
+			/**
+			 * 	@brief	(Re)build the index for the text passed with a chosen kernel
+			 *
+			 * 	Every kernel builds the same index, so this is for comparing and
+			 * 	timing them.  A kernel the cpu does not support is replaced by SCALAR
+			 *
+			 * 	@param	std::string_view		The text to index
+			 * 	@param	Kernel		The kernel to scan the blocks with
+			 * 	@return   bool						  If the index is usable for the text
+			 *
+			 * 	@version 0.1
+			 */
+			bool build(std::string_view text, Kernel kernel);
+
+			/**
+			 * 	@brief	Check if the index describes the text it was built from
+			 *
+			 * 	Texts over 4GB, or that quote strings with ' instead of ", are not indexed
+			 *
+			 * 	@return	bool		If the index can be used
+			 */
+			bool isValid() const {
+				return this->valid;
+			}
+
+			/**
+			 * 	@brief	Get the offsets of the token starts, in increasing order
+			 *
+			 * 	@return	const std::vector<uint32_t>&		The offsets
+			 */
+			const std::vector<uint32_t>& getPositions() const {
+				return this->positions;
+			}
+
+			/**
+			 * 	@brief	Get the kernel that is used on this machine
+			 *
+			 * 	@return	Kernel		The fastest kernel the cpu supports
+			 *
+			 * 	@version 0.1
+			 */
+			static Kernel getKernel();
+
+			/**
+			 * 	@brief	Check if the cpu can run a kernel
+			 *
+			 * 	@param	Kernel		The kernel
+			 * 	@return	bool		If the kernel can be used on this machine
+			 *
+			 * 	@version 0.1
+			 */
+			static bool isSupported(Kernel kernel);
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONStructuralIndex();
+
+		protected:
+			/// Offsets of the start of every token in the text
+			std::vector<uint32_t> positions;
+
+			/// If the positions describe the last text built from
+			bool valid;
+
+			/**
+			 * 	@brief	Fill the masks of one block with a chosen kernel
+			 *
+			 * 	@param	const char*		The 64 bytes of the block
+			 * 	@param	Kernel		The kernel, SCALAR if the cpu does not support it
+			 * 	@param	BlockMasks&		The masks filled
+			 *
+			 * 	@version 0.1
+			 */
+			static void scanBlock(const char* block, Kernel kernel, BlockMasks& masks);
+	};
+}
+#endif
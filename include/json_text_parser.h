@@ -7,16 +7,25 @@
  *  
  *  @author		Gabriel Shelton	sheltongabe
  *  @date		  07-31-2018
- *  @version	0.3
+ *  @version	0.5
  */
 
 #ifndef JSON_TEXT_PARSER_H
 #define JSON_TEXT_PARSER_H
 
-#include <sstream>
-#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include "json_compact_value.h"
+#include "json_cursor.h"
 #include "json_exception.h"
+#include "json_key.h"
+#include "json_structural_index.h"
+#include "json_tape.h"
+#include "json_thread_pool.h"
 #include "jsonable.h"
 
 namespace json {
@@ -26,7 +35,7 @@ namespace json {
 	 * 	@brief		A Pure static class that will handle conversions for json
 	 * 
 	 * 	Have a public interface that calls protected, recursive functions that will parse
-	 * 	a json string to JSON (std::map<std::string, JSONValue>)
+	 * 	a json string to JSON (JSONFlatMap<JSONValue>)
 	 * 
 	 */
 	class JSONTextParser {
@@ -45,17 +54,180 @@ namespace json {
 			/**
 			 * 	@brief 	Convert valid json text to a JSON object that JSONAble objects can be built from
 			 * 
-			 * 	-Call protected method recursiveObjectParser in order to handle the work horse
-			 * 	of the conversion
+			 * 	-Walk the text in place with a JSONCursor, calling the protected method
+			 * 	recursiveObjectParser in order to handle the work horse of the conversion
+			 * 	-Large texts are first scanned into a JSONStructuralIndex the cursor jumps through
 			 * 	-This method just stands as a public interface
 			 * 
-			 * 	@param		std::string	 			   jsonText 
+			 * 	@param		std::string_view		jsonText 
 			 * 	@return 	  JSON 						  Object the text represented
 			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
 			 * 
-			 *	@version 0.3
+			 *	@version 0.5
 			 */
-			static JSON parse(std::string jsonText);
+			static JSON parse(std::string_view jsonText);
+
+			/**
+			 * 	@brief 	Convert a buffer of valid json text to a JSON object
+			 * 
+			 * 	@param		const char*			   Start of the json text
+			 * 	@param		std::size_t			   Number of characters in the json text
+			 * 	@return 	  JSON 						  Object the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.5
+			 */
+			static JSON parse(const char* jsonText, std::size_t length);
+
+			/**
+			 * 	@brief 	Convert valid json text to a JSON object, interning the keys of its objects
+			 * 
+			 * 	Keys longer than JSONKey::INLINE_CAPACITY are shared with every key of the
+			 * 	same text the pool has handed out, so documents of many records hold each
+			 * 	key once and compare keys by pointer
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@param		JSONKeyPool&			 Pool the keys are interned in
+			 * 	@return 	  JSON 						  Object the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSON parse(std::string_view jsonText, JSONKeyPool& keys);
+
+			/**
+			 * 	@brief 	Convert json text holding any single value (not only an object) to a JSONValue
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@return 	  JSONValue 				 Value the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.5
+			 */
+			static JSONValue parseValue(std::string_view jsonText);
+
+			/**
+			 * 	@brief 	Convert json text holding any single value to a JSONValue, interning object keys
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@param		JSONKeyPool&			 Pool the keys are interned in
+			 * 	@return 	  JSONValue 				 Value the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSONValue parseValue(std::string_view jsonText, JSONKeyPool& keys);
+
+			/**
+			 * 	@brief 	Convert valid json text to a JSON object, parsing its members in parallel
+			 * 
+			 * 	See parseValueParallel, the text must hold an object
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@param		JSONThreadPool&		Pool the members are parsed on
+			 * 	@return 	  JSON 						  Object the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSON parseParallel(std::string_view jsonText,
+					JSONThreadPool& pool = JSONThreadPool::getShared());
+
+			/**
+			 * 	@brief 	Convert json text holding an object or array, parsing its members in parallel
+			 * 
+			 * 	-A scan of the JSONStructuralIndex finds where each top level member starts and ends
+			 * 	-The members are split into ranges parsed concurrently, array elements straight
+			 * 	into their slot of a pre-sized JSONArray
+			 * 	-Texts under PARALLEL_THRESHOLD, or that cannot be indexed, are parsed serially
+			 * 	-Must not be called from a task of the same pool
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@param		JSONThreadPool&		Pool the members are parsed on
+			 * 	@return 	  JSONValue 				 Value the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSONValue parseValueParallel(std::string_view jsonText,
+					JSONThreadPool& pool = JSONThreadPool::getShared());
+
+			/**
+			 * 	@brief 	Convert newline delimited json text, one object per line, handing each to a callback
+			 * 
+			 * 	-The text is cut into batches of whole lines that are parsed in parallel on the pool
+			 * 	-Records are handed to the callback in the order of the text, on the calling thread
+			 * 	-Blank lines are skipped
+			 * 
+			 * 	@param		std::string_view						 The lines, must stay valid until this returns
+			 * 	@param		std::function<void(JSON&)>		 Called with each record in order
+			 * 	@param		JSONThreadPool&						Pool the batches are parsed on
+			 * 	@throw		  JSONException		  If there is an error in the parsing of any line
+			 * 
+			 *	@version 0.1
+			 */
+			static void parseLines(std::string_view jsonLines, const std::function<void(JSON&)>& onRecord,
+					JSONThreadPool& pool = JSONThreadPool::getShared());
+
+			/**
+			 * 	@brief 	Convert json text holding any single value to a JSONCompactValue
+			 * 
+			 * 	The text is read by a JSONEventParser into a JSONCompactBuilder, so no
+			 * 	JSONValue is built along the way
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@return 	  JSONCompactValue 		Value the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSONCompactValue parseCompactValue(std::string_view jsonText);
+
+			/**
+			 * 	@brief 	Convert json text holding any single value to a JSONTape
+			 * 
+			 * 	The text is read by a JSONEventParser into a JSONTapeBuilder sized from the
+			 * 	text, so a typical document is parsed into two allocations
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@return 	  JSONTape 				  Tape of the value the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSONTape parseTape(std::string_view jsonText);
+
+			/**
+			 * 	@brief 	Convert an unquoted token (number, true, false, null) to its value
+			 * 
+			 * 	@param		std::string_view		The token, with no surrounding whitespace
+			 * 	@return 	  JSONValue 				 Value the token represented
+			 * 	@throw		  JSONException		  If the token is not a valid value
+			 * 
+			 *	@version 0.5
+			 */
+			static JSONValue convertBaseValue(std::string_view v);
+
+			/**
+			 * 	@brief 	Check a token against the json number grammar convertNumber reads
+			 * 
+			 * 	-? (0 | [1-9][0-9]*) (. [0-9]+)? ([eE] [+-]? [0-9]+)?, so no leading
+			 * 	zeros, no point without digits after it, no inf or nan
+			 * 
+			 * 	@param		std::string_view		The token, with no surrounding whitespace
+			 * 	@param		bool&		Set if the number has a fraction or exponent
+			 * 	@param		bool&		Set if the exponent is negative
+			 * 	@return 	  bool 				 If the token is a json number
+			 * 
+			 *	@version 0.1
+			 */
+			static bool isNumber(std::string_view v, bool& isFloat, bool& negativeExponent);
+
+			/// Check a token against the json number grammar
+			static bool isNumber(std::string_view v) {
+				bool isFloat = false, negativeExponent = false;
+				return JSONTextParser::isNumber(v, isFloat, negativeExponent);
+			}
 
 			/**
 			 * 	@brief 	Destructor
@@ -67,31 +239,81 @@ namespace json {
 			~JSONTextParser();
 
 		protected:
-			/// Characters that mark the beginning or termination of a string
-			static std::vector<char> STRING_MARKERS;
+			/// Texts at least this long are given a JSONStructuralIndex before they are parsed
+			static std::size_t STRUCTURAL_INDEX_THRESHOLD;
+
+			/// Number of characters of lines given to a worker at once when parsing lines
+			static std::size_t LINES_BATCH_SIZE;
+
+			/// Texts shorter than this are parsed serially by parseValueParallel
+			static std::size_t PARALLEL_THRESHOLD;
 
-			/// Characters that mark that string reading should be terminated
-			static std::vector<char> STRING_TERMINATERS;
+			/**
+			 * 	@brief 	Convert valid json text to a JSON object, interning keys if given a pool
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@param		JSONKeyPool*			 Pool to intern keys in, or nullptr
+			 * 	@return 	  JSON 						  Object the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSON parseObject(std::string_view jsonText, JSONKeyPool* keys);
 
-			/// The strings that are valid boolean
-			static std::vector<std::string> BOOLEAN_STRINGS;
+			/**
+			 * 	@brief 	Convert json text holding any single value, interning keys if given a pool
+			 * 
+			 * 	@param		std::string_view		jsonText 
+			 * 	@param		JSONKeyPool*			 Pool to intern keys in, or nullptr
+			 * 	@return 	  JSONValue 				 Value the text represented
+			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
+			 * 
+			 *	@version 0.1
+			 */
+			static JSONValue parseValue(std::string_view jsonText, JSONKeyPool* keys);
 
-			/// The characters that mark that a recurssive call is needed, and which call, passing std::stringstream
-			static std::map<char, JSONValue(*) (std::stringstream&)> RECURSIVE_CHARACTERS;
+			/**
+			 * 	@brief 	Find the members of the outermost object or array using the index
+			 * 
+			 * 	Each member is given as the offset it starts at and the offset of the , or
+			 * 	closing bracket after it.  Only the top level is checked, members are
+			 * 	checked when they are parsed.
+			 * 
+			 * 	@param		std::string_view								The indexed text
+			 * 	@param		const JSONStructuralIndex&					A valid index of the text
+			 * 	@param		std::vector<std::pair<std::size_t, std::size_t>>&		Filled with the members
+			 * 	@return		  bool		If the text is an object or array with a well formed top level
+			 * 
+			 * 	@version 0.1
+			 */
+			static bool findMembers(std::string_view jsonText, const JSONStructuralIndex& index,
+					std::vector<std::pair<std::size_t, std::size_t>>& members);
+
+			/**
+			 * 	@brief 	Parse every non-blank line of a batch
+			 * 
+			 * 	@param		std::string_view		Whole lines of json text
+			 * 	@return		  std::vector<JSON>	 The records, in order
+			 * 	@throw		  JSONException		  If there is an error in the parsing of any line
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::vector<JSON> parseLineBatch(std::string_view batch);
 
 			/**
-			 * 	@brief 	The workhorse of parsing JSON from a stringstream that is made
+			 * 	@brief 	The workhorse of parsing JSON from the text under the cursor
 			 * 
 			 * 	Parses the JSON potentially calling itself recursively, and provides the majority
 			 * 	of the work for the parsing returning eventually a moved JSON object
 			 * 
-			 * 	@param		std::stringstream	JSON being parsed
+			 * 	@param		JSONCursor&			 JSON being parsed
+			 * 	@param		JSONKeyPool*			 Pool to intern keys in, or nullptr
 			 * 	@return		  JSON						 The object representation of the JSON
 			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
 			 * 
-			 * 	@version 0.4
+			 * 	@version 0.6
 			 */
-			static JSONValue recursiveObjectParser(std::stringstream& s);
+			static JSONValue recursiveObjectParser(JSONCursor& s, JSONKeyPool* keys = nullptr);
 
 			/**
 			 * 	@brief 	Recursively turns jsonText arrays into JSONArray (vector) returned
@@ -99,57 +321,59 @@ namespace json {
 			 * 	Parses the JSONArray potentially calling itself recursively, and 
 			 * 	returning eventually, a moved JSONArray object
 			 * 
-			 * 	@param		std::stringstream	JSON being parsed
+			 * 	@param		JSONCursor&			 JSON being parsed
+			 * 	@param		JSONKeyPool*			 Pool to intern keys in, or nullptr
 			 * 	@return		  JSONArray				 The object representation of the JSONArray
 			 * 	@throw		  JSONException		  If there is an error in the parsing of the JSON
 			 * 
-			 * 	@version 0.4
+			 * 	@version 0.6
 			 */
-			static JSONValue recursiveArrayParser(std::stringstream& s);
+			static JSONValue recursiveArrayParser(JSONCursor& s, JSONKeyPool* keys = nullptr);
 
 			/**
-			 * @brief		Read in a string object or read till a STRING_TERMINATOR character
+			 * @brief		Read in a quoted string
 			 * 
-			 * @param 	std::stringstream	stream to read from
+			 * @param 	JSONCursor&				cursor on the opening quote
 			 * @return    std::string 				string read in
 			 * 
-			 * 	@version 0.1
+			 * 	@version 0.5
 			 */
-			static JSONValue getString(std::stringstream& s);
+			static JSONValue getString(JSONCursor& s);
 
 			/**
-			 * @brief		Get the value stored 
+			 * @brief		Get the value stored, dispatching on its first character
 			 * 
-			 * @param 	std::stringstream&	 stream to read from
+			 * @param 	JSONCursor&			 cursor to read from
+			 * @param 	JSONKeyPool*			 Pool to intern keys in, or nullptr
 			 * @return    JSONValue 			  	Value read in
 			 * 
-			 * 	@version 0.4
+			 * 	@version 0.6
 			 */
-			static JSONValue getValue(std::stringstream& s);
+			static JSONValue getValue(JSONCursor& s, JSONKeyPool* keys = nullptr);
 
 			/**
 			 * @brief		Get the value stored if it does not require a recurssive read or is not a string
 			 * 
-			 * @param 	std::stringstream&	 stream to read from
-			 * @return    JSONValue 			 	string read in
+			 * @param 	JSONCursor&			 cursor to read from
+			 * @return    JSONValue 			 	Value read in
 			 * 
-			 * 	@version 0.4
+			 * 	@version 0.5
 			 */
-			static JSONValue getBaseValue(std::stringstream& s);
+			static JSONValue getBaseValue(JSONCursor& s);
 
 			/**
-			 * 	@brief	Check to see if the passed value is in the passed vector
+			 * @brief		Convert a number, the json grammar decides if it is an integer or floating point
 			 * 
-			 * 	uses count in std::algorithm to see if the value is in the vector
+			 * Integers are stored in the smallest of int, int64_t and uint64_t that holds them,
+			 * and as a double if none do.  Nothing is allocated and the locale is not used.
 			 * 
-			 * 	@param		T			Value
-			 * 	@param		T			Vector containting type T
-			 * 	@return		  bool	   If value is in the vector
+			 * @param 	std::string_view		 The number
+			 * @return    JSONValue 			 	The value of the number
+			 * @throw	  JSONException		  If the text is not a valid number
 			 * 
-			 * 	@version 0.1
+			 * 	@version 0.5
 			 */
-			template <typename T>
-			static bool isIn(T value, std::vector<T>);
+			static JSONValue convertNumber(std::string_view v);
 
 		private:
 
@@ -0,0 +1,137 @@
+/**
+ *  @file		json_thread_pool.h
+ *  @brief	  A fixed set of worker threads that the parallel readers and writers share
+ *
+ * 	Tasks are queued and run by the first free worker, each submission hands
+ * 	back a std::future for the task's result
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_THREAD_POOL_H
+#define JSON_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace json {
+
+	/**
+	 * 	@class		JSONThreadPool
+	 * 	@brief		Run tasks on a fixed number of worker threads
+	 *
+	 * 	Tasks must not wait on other tasks of the same pool, or every worker
+	 * 	could end up waiting
+	 *
+	 */
+	class JSONThreadPool {
+		public:
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Start the workers
+			 *
+			 * 	@param	std::size_t		Number of workers, 0 uses one per hardware thread
+			 *
+			 * 	@version	0.1
+			 */
+			JSONThreadPool(std::size_t numThreads = 0);
+
+			/// Copying is not allowed, the workers belong to one pool
+			JSONThreadPool(const JSONThreadPool& copy) = delete;
+
+			/**
+			 * 	@brief	Queue a task to be run by a worker
+			 *
+			 * 	@param	F								The task, callable with no arguments
+			 * 	@return	std::future<R>		  The result of the task, or the exception it threw
+			 */
+			template <typename F>
+			auto submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+				using R = std::invoke_result_t<std::decay_t<F>>;
+
+				auto packaged = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+				std::future<R> result = packaged->get_future();
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->tasks.emplace([packaged]() { (*packaged)(); });
+				}
+				this->ready.notify_one();
+
+				return result;
+			}
+
+			/**
+			 * 	@brief	Wait for every task, then rethrow the first error any of them threw
+			 *
+			 * 	No task is still running once this returns or throws, so they may
+			 * 	refer to the caller's locals
+			 *
+			 * 	@param	std::vector<std::future<void>>&		The tasks to wait for
+			 *
+			 * 	@version 0.1
+			 */
+			static void waitAll(std::vector<std::future<void>>& results);
+
+			/**
+			 * 	@brief	Get the number of workers
+			 *
+			 * 	@return	std::size_t		The number of workers
+			 */
+			std::size_t getNumThreads() const {
+				return this->workers.size();
+			}
+
+			/**
+			 * 	@brief	Get a pool shared by the whole process, started on first use
+			 *
+			 * 	@return	JSONThreadPool&		A pool with one worker per hardware thread
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONThreadPool& getShared();
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Finish the queued tasks, then stop and join the workers
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONThreadPool();
+
+		protected:
+			/// The worker threads
+			std::vector<std::thread> workers;
+
+			/// Tasks waiting for a worker
+			std::queue<std::function<void()>> tasks;
+
+			/// Guards tasks and stopping
+			std::mutex mutex;
+
+			/// Signalled when a task is queued or the pool is stopping
+			std::condition_variable ready;
+
+			/// Set when the workers should exit
+			bool stopping;
+
+			/**
+			 * 	@brief	The loop each worker runs, taking tasks until the pool stops
+			 *
+			 * 	@version 0.1
+			 */
+			void work();
+	};
+}
+#endif
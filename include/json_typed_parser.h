@@ -0,0 +1,391 @@
+/**
+ *  @file		json_typed_parser.h
+ *  @brief	  Parse json text straight into the fields of types declared with JSON_FIELDS
+ *
+ * 	No JSON map is built.  The cursor walks the text once, each key is hashed
+ * 	into a perfect hash table made at compile time from the type's field
+ * 	names, and a hit is confirmed with one comparison before the value is read
+ * 	straight into the member.  Keys that are not fields have their values
+ * 	skipped without being built.  Numbers, bools and strings are converted
+ * 	in place, anything unusual is parsed the usual way and handed to
+ * 	JSONFields::readValue, so both paths read the same fields from the same
+ * 	text and reject the same values in them.  A key given more than once
+ * 	keeps its first value, as JSONFlatMap::emplace does for the DOM.  The
+ * 	values of members that are not fields, and of repeated keys, are only
+ * 	read far enough to find their end.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_TYPED_PARSER_H
+#define JSON_TYPED_PARSER_H
+
+#include <array>
+#include <bitset>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json_cursor.h"
+#include "json_exception.h"
+#include "json_fields.h"
+#include "json_string.h"
+#include "json_structural_index.h"
+#include "json_text_parser.h"
+#include "jsonable.h"
+
+namespace json {
+	/**
+	 * 	@struct		JSONPerfectHash
+	 * 	@brief		A table from N names to their positions with no collisions, built at compile time
+	 *
+	 * 	Seeds are tried until every name hashes to its own slot.  With four
+	 * 	slots per name that takes a few tries at most.
+	 *
+	 */
+	template <std::size_t N>
+	struct JSONPerfectHash {
+		/// Number of slots, the power of two at least four times the number of names
+		static constexpr std::size_t SIZE = (N <= 1) ? 4 :
+				std::size_t(1) << (64 - __builtin_clzll(static_cast<unsigned long long>(4 * N - 1)));
+
+		/// The seed that spreads the names into their own slots
+		uint64_t seed = 0;
+
+		/// Position of the name in each slot plus one, 0 for an empty slot
+		std::array<uint8_t, SIZE> slots{};
+
+		/// Hash a key with a seed, usable at compile time
+		static constexpr uint64_t hash(std::string_view key, uint64_t seed) {
+			uint64_t h = 14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+			for(char c : key) {
+				h ^= static_cast<unsigned char>(c);
+				h *= 1099511628211ULL;
+			}
+			return h ^ (h >> 29);
+		}
+
+		/**
+		 * 	@brief	Build the table of a set of names
+		 *
+		 * 	@param	const std::array<std::string_view, N>&		The names, which must all differ
+		 * 	@return	JSONPerfectHash		The table
+		 *
+		 * 	@version 0.1
+		 */
+		static constexpr JSONPerfectHash build(const std::array<std::string_view, N>& names) {
+			static_assert(N < 255, "Too many names for a perfect hash");
+
+			JSONPerfectHash table;
+			for(uint64_t seed = 0; ; ++seed) {
+				table.seed = seed;
+				table.slots = std::array<uint8_t, SIZE>{};
+
+				bool collided = false;
+				for(std::size_t i = 0; i < N && !collided; ++i) {
+					uint8_t& slot = table.slots[hash(names[i], seed) & (SIZE - 1)];
+					collided = (slot != 0);
+					slot = static_cast<uint8_t>(i + 1);
+				}
+				if(!collided)
+					return table;
+
+				// Equal names collide under every seed
+				if(seed == 1 << 16)
+					throw JSONException("Json fields have the same name");
+			}
+		}
+
+		/// Get the position of the name a key could be, or N if it is none of them
+		constexpr std::size_t find(std::string_view key) const {
+			const uint8_t slot = this->slots[hash(key, this->seed) & (SIZE - 1)];
+			return (slot == 0) ? N : slot - 1;
+		}
+	};
+
+	/**
+	 * 	@class		JSONTypedParser
+	 * 	@brief		Purely static class that parses text into types declared with JSON_FIELDS
+	 *
+	 * 	-parse: text of one object -> a T
+	 * 	-parseArray: text of an array of objects -> std::vector<T>
+	 * 	-parseLines: newline delimited objects -> each T handed to a callback in order
+	 * 	The result matches JSONFields::fromJSON of the parsed text, fields that
+	 * 	are not in the text keep their default values.
+	 *
+	 */
+	class JSONTypedParser {
+		public:
+			/// Texts at least this long are given a JSONStructuralIndex before they are parsed
+			static std::size_t STRUCTURAL_INDEX_THRESHOLD;
+
+			/**
+			 * 	@brief	Parse the text of an object into a T
+			 *
+			 * 	@param	std::string_view		The text
+			 * 	@param	T&		The object, fields not in the text are left as they are
+			 * 	@throw	  JSONException		  If the text is not valid json or does not fit T
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename T>
+			static void parse(std::string_view jsonText, T& out) {
+				JSONCursor s(jsonText);
+				JSONStructuralIndex index;
+				if(jsonText.size() >= JSONTypedParser::STRUCTURAL_INDEX_THRESHOLD && index.build(jsonText))
+					s.setIndex(index);
+
+				s.skipWhitespace();
+				JSONTypedParser::readValue(s, out, std::string_view());
+				JSONTypedParser::expectEnd(s);
+			}
+
+			/// Parse the text of an object into a new T
+			template <typename T>
+			static T parse(std::string_view jsonText) {
+				T out{};
+				JSONTypedParser::parse(jsonText, out);
+				return out;
+			}
+
+			/// Parse the text of an array of objects into a vector of T
+			template <typename T>
+			static std::vector<T> parseArray(std::string_view jsonText) {
+				std::vector<T> out;
+				JSONTypedParser::parse(jsonText, out);
+				return out;
+			}
+
+			/**
+			 * 	@brief	Parse newline delimited objects, handing each to a callback in order
+			 *
+			 * 	Blank lines are skipped
+			 *
+			 * 	@param	std::string_view		The lines
+			 * 	@param	Callback		Called with a T& for each record
+			 * 	@throw	  JSONException		  If a line is not valid json or does not fit T
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename T, typename Callback>
+			static void parseLines(std::string_view jsonLines, Callback onRecord) {
+				while(!jsonLines.empty()) {
+					const std::size_t newline = jsonLines.find('\n');
+					const std::string_view line = jsonLines.substr(0, newline);
+					jsonLines.remove_prefix(newline == std::string_view::npos ? jsonLines.size() : newline + 1);
+
+					if(line.find_first_not_of(" \t\r") == std::string_view::npos)
+						continue;
+
+					T record{};
+					JSONTypedParser::parse(line, record);
+					onRecord(record);
+				}
+			}
+
+		protected:
+			/// A function that reads the value of one field of a T
+			template <typename T>
+			using FieldReader = void (*)(JSONCursor&, T&);
+
+			/// Number of fields of a T
+			template <typename T>
+			static constexpr std::size_t NUM_FIELDS =
+					std::tuple_size_v<std::decay_t<decltype(JSONFields::FIELDS<T>)>>;
+
+			/// Get the names of a T's fields, in order
+			template <typename T>
+			static constexpr std::array<std::string_view, NUM_FIELDS<T>> getNames() {
+				return std::apply([](const auto&... fields) {
+					return std::array<std::string_view, sizeof...(fields)>{fields.name...};
+				}, JSONFields::FIELDS<T>);
+			}
+
+			/// Read the value of the field at position I of a T
+			template <typename T, std::size_t I>
+			static void readField(JSONCursor& s, T& out) {
+				const auto& field = std::get<I>(JSONFields::FIELDS<T>);
+				JSONTypedParser::readValue(s, out.*(field.member), field.name);
+			}
+
+			/// Get a reader for each field of a T, in order
+			template <typename T, std::size_t... I>
+			static constexpr std::array<FieldReader<T>, sizeof...(I)> getReaders(std::index_sequence<I...>) {
+				return {&JSONTypedParser::readField<T, I>...};
+			}
+
+			/**
+			 * 	@brief	Read an object into a T's fields, the cursor must be on the '{'
+			 *
+			 * 	@param	JSONCursor&		The cursor
+			 * 	@param	T&		The object
+			 * 	@throw	  JSONException		  If the text is not valid json or does not fit T
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename T>
+			static void readObject(JSONCursor& s, T& out) {
+				static constexpr std::array<std::string_view, NUM_FIELDS<T>> NAMES =
+						JSONTypedParser::getNames<T>();
+				static constexpr JSONPerfectHash<NUM_FIELDS<T>> TABLE =
+						JSONPerfectHash<NUM_FIELDS<T>>::build(NAMES);
+				static constexpr std::array<FieldReader<T>, NUM_FIELDS<T>> READERS =
+						JSONTypedParser::getReaders<T>(std::make_index_sequence<NUM_FIELDS<T>>());
+
+				// Holds a key that had escapes
+				std::string scratch;
+
+				// The fields read so far, a repeated key keeps the first value as the DOM does
+				std::bitset<NUM_FIELDS<T>> seen;
+
+				s.expect('{', "Error parsing object in json text");
+				while(s.peekNonSpace() != '}') {
+					const char starter = s.peek();
+					if(starter != '\"' && starter != '\'')
+						s.fail("Error parsing key of object in json text");
+					const std::string_view key = JSONString::unescaped(s.readString(), scratch);
+					s.expect(':', "Error parsing Object in json text");
+
+					// Read a field's value in place the first time, and step over anything else
+					const std::size_t field = TABLE.find(key);
+					s.skipWhitespace();
+					if(field < NUM_FIELDS<T> && NAMES[field] == key && !seen[field]) {
+						seen[field] = true;
+						READERS[field](s, out);
+					}
+					else
+						s.skipValue();
+
+					const char next = s.peekNonSpace();
+					if(next == ',')
+						s.get();
+					else if(next != '}')
+						s.fail("Error parsing object in json text");
+				}
+				s.get();
+			}
+
+			/// Read an array into a vector, the cursor must be on the '['
+			template <typename V>
+			static void readArray(JSONCursor& s, V& out, std::string_view name) {
+				out.clear();
+				s.expect('[', "Error parsing array in json text");
+				while(s.peekNonSpace() != ']') {
+					typename V::value_type element{};
+					JSONTypedParser::readValue(s, element, name);
+					out.push_back(std::move(element));
+
+					const char next = s.peekNonSpace();
+					if(next == ',')
+						s.get();
+					else if(next != ']')
+						s.fail("Error parsing array in json text");
+				}
+				s.get();
+			}
+
+			/**
+			 * 	@brief	Read a value into a field, the cursor must be on its first character
+			 *
+			 * 	@param	JSONCursor&		The cursor
+			 * 	@param	M&		The field
+			 * 	@param	std::string_view		Name of the field, for errors
+			 * 	@throw	  JSONException		  If the text is not valid json or does not fit the field
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename M>
+			static void readValue(JSONCursor& s, M& out, std::string_view name) {
+				const char starter = s.peek();
+				if constexpr(JSONFields::IsReflected<M>::value) {
+					if(starter == '{')
+						return JSONTypedParser::readObject(s, out);
+				}
+				else if constexpr(JSONFields::IsVector<M>::value) {
+					if(starter == '[')
+						return JSONTypedParser::readArray(s, out, name);
+				}
+				else if constexpr(std::is_same_v<M, std::string>) {
+					if(starter == '"' || starter == '\'') {
+						out.clear();
+						JSONString::appendUnescaped(s.readString(), out);
+						return;
+					}
+				}
+				else if constexpr(std::is_same_v<M, bool>) {
+					if(starter == 't' || starter == 'f') {
+						const std::string_view token = s.readToken();
+						if(token == "true" || token == "false") {
+							out = (token == "true");
+							return;
+						}
+						JSONFields::readValue(JSONTextParser::convertBaseValue(token), out, name);
+						return;
+					}
+				}
+				else if constexpr(std::is_arithmetic_v<M>) {
+					if(starter == '-' || (starter >= '0' && starter <= '9')) {
+						// from_chars takes more than json does (01, 1.e5, -.5, inf), so only
+						// tokens that follow the grammar the usual way checks are read here
+						const std::string_view token = s.readToken();
+						bool isFloat = false, negativeExponent = false;
+						if(JSONTextParser::isNumber(token, isFloat, negativeExponent)) {
+							if constexpr(std::is_floating_point_v<M>) {
+								// Read as the double the usual way holds, so a float is rounded the same
+								double number;
+								const std::from_chars_result read =
+										std::from_chars(token.data(), token.data() + token.size(), number);
+								if(read.ec == std::errc() && read.ptr == token.data() + token.size()) {
+									// The usual way holds integers as one, which has no -0
+									if(!isFloat && number == 0)
+										number = 0;
+									JSONFields::readValue(JSONValue(number), out, name);
+									return;
+								}
+							}
+							else {
+								const std::from_chars_result read =
+										std::from_chars(token.data(), token.data() + token.size(), out);
+								if(read.ec == std::errc() && read.ptr == token.data() + token.size())
+									return;
+							}
+						}
+
+						// Fractions into integers, numbers out of range, and the rest convert the usual way
+						JSONFields::readValue(JSONTextParser::convertBaseValue(token), out, name);
+						return;
+					}
+				}
+				else if constexpr(std::is_same_v<M, JSONValue>) {
+					out = JSONTypedParser::readAny(s);
+					return;
+				}
+
+				// Anything else is built, so it is accepted or rejected the same as by JSONFields
+				JSONFields::readValue(JSONTypedParser::readAny(s), out, name);
+			}
+
+			/**
+			 * 	@brief	Parse the value at the cursor the usual way
+			 *
+			 * 	@param	JSONCursor&		The cursor, on the value's first character
+			 * 	@return	JSONValue		The value
+			 * 	@throw	  JSONException		  If the text is not valid json
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONValue readAny(JSONCursor& s);
+
+			/// Throw a JSONException if anything but whitespace is left
+			static void expectEnd(JSONCursor& s);
+	};
+}
+#endif
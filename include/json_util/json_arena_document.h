@@ -0,0 +1,195 @@
+/**
+ *  @file		json_arena_document.h
+ *  @brief	  A json document whose values are all allocated from one arena
+ *
+ * 	Mirrors JSONValue, JSONObject and JSONArray with std::pmr containers, so every
+ * 	key, string, member and element of a document comes from the document's
+ * 	memory resource.  Parsing takes a few large blocks instead of one allocation
+ * 	per value, and the document is freed by releasing the blocks
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_ARENA_DOCUMENT_H
+#define JSON_ARENA_DOCUMENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "json_event_handler.h"
+#include "json_exception.h"
+#include "jsonable.h"
+
+namespace json {
+	class JSONArenaObject;
+	class JSONArenaArray;
+
+	/// A JSONValue whose strings, objects and arrays allocate from a memory resource
+	using JSONArenaValue = std::variant<
+			int, double, std::pmr::string, bool, std::monostate, JSONArenaObject, JSONArenaArray,
+			int64_t, uint64_t>;
+
+	/// Members are looked up with any string type, without building a key
+	using JSONArenaMap = std::map<std::pmr::string, JSONArenaValue, std::less<>,
+			std::pmr::polymorphic_allocator<std::pair<const std::pmr::string, JSONArenaValue>>>;
+
+	/**
+	 * 	@class		JSONArenaObject
+	 * 	@brief		A JSONObject allocated from a memory resource
+	 *
+	 */
+	class JSONArenaObject : public JSONArenaMap {
+		public:
+			using JSONArenaMap::JSONArenaMap;
+	};
+
+	/**
+	 * 	@class		JSONArenaArray
+	 * 	@brief		A JSONArray allocated from a memory resource
+	 *
+	 */
+	class JSONArenaArray : public std::pmr::vector<JSONArenaValue> {
+		public:
+			using std::pmr::vector<JSONArenaValue>::vector;
+	};
+
+	/**
+	 * 	@struct		JSONArenaTraits
+	 * 	@brief		How a JSONBasicBuilder makes and fills JSONArenaValues
+	 *
+	 * 	Everything built is allocated from the resource given, the builder's own
+	 * 	bookkeeping is not.  Moving a value keeps its resource.
+	 *
+	 */
+	struct JSONArenaTraits {
+		using Value = JSONArenaValue;
+		using Object = JSONArenaObject;
+		using Array = JSONArenaArray;
+		using Key = std::pmr::string;
+
+		/// Resource the values are allocated from
+		std::pmr::memory_resource* resource;
+
+		/// Initializing Constructor
+		JSONArenaTraits(std::pmr::memory_resource* resource) : resource(resource) { }
+
+		Value makeObject() const { return JSONArenaObject(this->resource); }
+		Value makeArray() const { return JSONArenaArray(this->resource); }
+		Key makeKey() const { return Key(this->resource); }
+		Value makeString(std::string_view value) const { return std::pmr::string(value, this->resource); }
+		Value makeNull() const { return std::monostate(); }
+
+		/// Get the object a value holds, or nullptr if it holds an array
+		static Object* getObject(Value& value) { return std::get_if<JSONArenaObject>(&value); }
+
+		/// Get the array a value holds
+		static Array& getArray(Value& value) { return std::get<JSONArenaArray>(value); }
+	};
+
+	/// Builds a JSONArenaValue from events, constructed with the resource to allocate from
+	using JSONArenaBuilder = JSONBasicBuilder<JSONArenaTraits>;
+
+	// Built once, in json_arena_document.cpp
+	extern template class JSONBasicBuilder<JSONArenaTraits>;
+
+	/**
+	 * 	@class		JSONArenaDocument
+	 * 	@brief		Parse json text into values that live in the document's own arena
+	 *
+	 * 	The arena is a std::pmr::monotonic_buffer_resource, so nothing is freed
+	 * 	until the document is destroyed, and then everything is freed at once
+	 * 	without visiting the values.  Values must not be moved out to outlive the
+	 * 	document.  The arena is not thread safe, one document should only be
+	 * 	changed by one thread at a time.
+	 *
+	 */
+	class JSONArenaDocument {
+		public:
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Parse the text into the arena, whose first block is about the size of the text
+			 *
+			 * 	@param	std::string_view					The json text, only read during construction
+			 * 	@param	std::pmr::memory_resource*		Resource the arena takes its blocks from
+			 * 	@throw	  JSONException				 If the text is not valid json
+			 *
+			 * 	@version	0.1
+			 */
+			JSONArenaDocument(std::string_view jsonText,
+					std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+			/// Copying is not allowed, the values belong to the arena
+			JSONArenaDocument(const JSONArenaDocument& copy) = delete;
+
+			/**
+			 * 	@brief	Get the value the whole document holds
+			 *
+			 * 	@return	JSONArenaValue&		The root value
+			 */
+			JSONArenaValue& getRoot() {
+				return *this->root;
+			}
+
+			/// Get the value the whole document holds
+			const JSONArenaValue& getRoot() const {
+				return *this->root;
+			}
+
+			/**
+			 * 	@brief	Get the arena, to allocate values added to the document from
+			 *
+			 * 	@return	std::pmr::memory_resource*		The arena
+			 */
+			std::pmr::memory_resource* getResource() {
+				return &this->arena;
+			}
+
+			/**
+			 * 	@brief	Find the member of the root object with the key
+			 *
+			 * 	@param	std::string_view		The key
+			 * 	@return	const JSONArenaValue&		The member
+			 * 	@throw	  JSONException		  If the root is not an object or has no such member
+			 *
+			 * 	@version 0.1
+			 */
+			const JSONArenaValue& operator[](std::string_view key) const;
+
+			/**
+			 * 	@brief	Copy a value out of the arena into a regular JSONValue
+			 *
+			 * 	@param	const JSONArenaValue&		The value to copy
+			 * 	@return	JSONValue			  The same value, using the default allocator
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONValue toJSONValue(const JSONArenaValue& value);
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Release the arena, the values are not destroyed one by one
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONArenaDocument();
+
+		protected:
+			/// Every value of the document is allocated from here
+			std::pmr::monotonic_buffer_resource arena;
+
+			/// The root value, itself allocated in the arena
+			JSONArenaValue* root;
+	};
+}
+#endif
@@ -0,0 +1,128 @@
+/**
+ *  @file		json_compare.h
+ *  @brief	  Define a visitor for comparing JSONValues	
+ *  
+ * 	Compare two JSONValues using the std::visit pattern
+ * 	the left-hand-side is passed during construction, and the right w/ visit
+ *  
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  08-02-2018
+ *  @version	0.5
+ */
+
+#ifndef JSON_COMPARE_H
+#define JSON_COMPARE_H
+
+#include <type_traits>
+
+#include "jsonable.h"
+
+namespace json {
+
+	/**
+	 * 	@struct		JSONCompare
+	 * 	@brief		 Define how to compare two JSONValues
+	 * 
+	 * 	Left-hand-side is passed by reference in the constructor,
+	 * 	default constructor is deleted
+	 * 	Right hand side is called by std::visit
+	 * 
+	 */
+	struct JSONCompare {
+		/// Left hand side of the comparison
+		const JSONValue& left;
+
+		/// Used for comparing doubles, if they are that close they are considered equal
+		static constexpr double EPSILON = 0.000001;
+
+		/**
+		 * 	@brief	Default Constructor
+		 * 
+		 * 	Details
+		 * 
+		 * 	@version	0.0
+		 */
+		JSONCompare() = delete;
+
+		/**
+		 * 	@brief	Initializing Constructor
+		 * 
+		 * 	Initialize left-hand-side
+		 * 
+		 * 	@version	0.4
+		 */
+		JSONCompare(const JSONValue& left) : left(left) { }
+
+		/**
+		 * 	@brief 	Compare for a double
+		 * 
+		 * 	@param double	  	    Right hand side of the comparison
+		 * 	@return bool				Result of the comparison 
+		 */
+		bool operator()(const double& right);
+
+		// ----- Comparisons -----
+		/**
+		 * 	@brief 	Compare for a JSONObject, members are matched by key in any order
+		 * 
+		 * 	@param JSONObject 	Right hand side of the comparison
+		 * 	@return bool				Result of the comparison 
+		 */
+		bool operator()(const JSONObject& right);
+
+		/**
+		 * 	@brief 	Compare for a JSONArray
+		 * 
+		 * 	@param JSONArray 	 Right hand side of the comparison
+		 * 	@return bool				Result of the comparison 
+		 */
+		bool operator()(const JSONArray& right);
+
+		/**
+		 * 	@brief 	Compare for std::monostate
+		 * 
+		 * 	@param std::monostate 	 Right hand side of the comparison
+		 * 	@return bool						Result of the comparison 
+		 */
+		bool operator()(const std::monostate& right);
+
+		/**
+		 * 	@brief 	Compare for a generic auto determined type
+		 * 
+		 * 	Integers are equal when their values are, no matter which width stores them
+		 * 
+		 * 	@param T				 	 Right hand side of the comparison
+		 * 	@return bool				Result of the comparison 
+		 */
+		template<typename T>
+		bool operator()(const T& right);
+
+		/**
+		 * 	@brief	Compare two integers of possibly different signedness by value
+		 * 
+		 * 	@param	A				 Left integer
+		 * 	@param	B				 Right integer
+		 * 	@return bool			If the values are equal
+		 */
+		template<typename A, typename B>
+		static bool integerEqual(A left, B right) {
+			if constexpr(std::is_signed_v<A> == std::is_signed_v<B>)
+				return left == right;
+			else if constexpr(std::is_signed_v<A>)
+				return left >= 0 && static_cast<uint64_t>(left) == right;
+			else
+				return right >= 0 && left == static_cast<uint64_t>(right);
+		}
+
+		/**
+		 * 	@brief	Destructor
+		 * 
+		 * 	Details
+		 * 
+		 * 	@version	0.4
+		 */
+		~JSONCompare() { }
+	};
+
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,273 @@
+/**
+ *  @file		json_event_handler.h
+ *  @brief	  Define the callbacks json text is reported through while it is read
+ *
+ * 	A JSONEventHandler is told about each piece of json (the start of an object,
+ * 	a key, a number, ...) in the order it appears, without anything being kept.
+ * 	JSONBuilder is a handler that puts the pieces back together into a JSONValue,
+ * 	and JSONBasicBuilder does the same for the other kinds of document
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_EVENT_HANDLER_H
+#define JSON_EVENT_HANDLER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "jsonable.h"
+
+namespace json {
+
+	/**
+	 * 	@class		JSONEventHandler
+	 * 	@brief		Overloaded by the client to be told about json as it is read
+	 *
+	 * 	Every callback does nothing by default, so only the ones of interest need
+	 * 	to be overloaded.  Views passed to the callbacks are only valid during the call.
+	 *
+	 */
+	class JSONEventHandler {
+		public:
+			/// An object was opened with '{'
+			virtual void onStartObject() { }
+
+			/// The key of the next member of the open object
+			virtual void onKey(std::string_view /*key*/) { }
+
+			/// The open object was closed with '}'
+			virtual void onEndObject() { }
+
+			/// An array was opened with '['
+			virtual void onStartArray() { }
+
+			/// The open array was closed with ']'
+			virtual void onEndArray() { }
+
+			/// An integer value
+			virtual void onInt(int /*value*/) { }
+
+			/// An integer value too large for an int
+			virtual void onInt64(int64_t /*value*/) { }
+
+			/// A positive integer value too large for an int64_t
+			virtual void onUint64(uint64_t /*value*/) { }
+
+			/// A floating point value
+			virtual void onDouble(double /*value*/) { }
+
+			/// A string value
+			virtual void onString(std::string_view /*value*/) { }
+
+			/// A boolean value
+			virtual void onBool(bool /*value*/) { }
+
+			/// A null value
+			virtual void onNull() { }
+
+			/**
+			 * 	@brief	Report a scalar JSONValue through the matching callback
+			 *
+			 * 	@param	const JSONValue&		An integer, double, string, bool or null value
+			 *
+			 * 	@version 0.1
+			 */
+			void onValue(const JSONValue& value);
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			virtual ~JSONEventHandler();
+	};
+
+	/**
+	 * 	@struct		JSONValueTraits
+	 * 	@brief		How a JSONBasicBuilder makes and fills JSONValues
+	 *
+	 * 	Traits name the Value, Object, Array and Key types of one kind of document,
+	 * 	make empty ones, and reach the object or array inside a value.  Traits
+	 * 	that need state, such as a memory resource, are given the builder's
+	 * 	constructor arguments.
+	 *
+	 */
+	struct JSONValueTraits {
+		using Value = JSONValue;
+		using Object = JSONObject;
+		using Array = JSONArray;
+		using Key = std::string;
+
+		Value makeObject() const { return JSONObject(); }
+		Value makeArray() const { return JSONArray(); }
+		Key makeKey() const { return Key(); }
+		Value makeString(std::string_view value) const { return std::string(value); }
+		Value makeNull() const { return std::monostate(); }
+
+		/// Get the object a value holds, or nullptr if it holds an array
+		static Object* getObject(Value& value) { return std::get_if<JSONObject>(&value); }
+
+		/// Get the array a value holds
+		static Array& getArray(Value& value) { return std::get<JSONArray>(value); }
+	};
+
+	/**
+	 * 	@class		JSONBasicBuilder
+	 * 	@brief		Build the value that the events describe, of the kind Traits makes
+	 *
+	 * 	Open containers are kept on a stack, and moved into their parent when closed
+	 *
+	 */
+	template <typename Traits>
+	class JSONBasicBuilder : public JSONEventHandler {
+		public:
+			using Value = typename Traits::Value;
+			using Object = typename Traits::Object;
+			using Array = typename Traits::Array;
+			using Key = typename Traits::Key;
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Start with nothing built
+			 *
+			 * 	@param	Args&&...		Handed to the traits, such as the memory resource to allocate from
+			 *
+			 * 	@version	0.1
+			 */
+			template <typename... Args>
+			explicit JSONBasicBuilder(Args&&... args) :
+					traits(std::forward<Args>(args)...), root(this->traits.makeNull()), complete(false) { }
+
+			// ----- Events, each one adds to the value being built -----
+			virtual void onStartObject() override {
+				this->stack.push_back(this->traits.makeObject());
+				this->keys.push_back(this->traits.makeKey());
+			}
+
+			virtual void onKey(std::string_view key) override {
+				this->keys.back().assign(key.data(), key.size());
+			}
+
+			virtual void onEndObject() override {
+				Value object = std::move(this->stack.back());
+				this->stack.pop_back();
+				this->keys.pop_back();
+				this->add(std::move(object));
+			}
+
+			virtual void onStartArray() override {
+				this->stack.push_back(this->traits.makeArray());
+			}
+
+			virtual void onEndArray() override {
+				Value array = std::move(this->stack.back());
+				this->stack.pop_back();
+				this->add(std::move(array));
+			}
+
+			virtual void onInt(int value) override { this->add(value); }
+			virtual void onInt64(int64_t value) override { this->add(value); }
+			virtual void onUint64(uint64_t value) override { this->add(value); }
+			virtual void onDouble(double value) override { this->add(value); }
+			virtual void onString(std::string_view value) override { this->add(this->traits.makeString(value)); }
+			virtual void onBool(bool value) override { this->add(value); }
+			virtual void onNull() override { this->add(this->traits.makeNull()); }
+
+			/**
+			 * 	@brief	Check if a whole value has been built
+			 *
+			 * 	@return	bool		If the outermost value has been finished
+			 */
+			bool isComplete() const {
+				return this->complete;
+			}
+
+			/**
+			 * 	@brief	Take the value built, and start over
+			 *
+			 * 	@return	Value		The value built
+			 *
+			 * 	@version 0.1
+			 */
+			Value takeValue() {
+				Value value = std::move(this->root);
+				this->root = this->traits.makeNull();
+				this->complete = false;
+				return value;
+			}
+
+			/**
+			 * 	@brief	Drop anything built so far, keeping the room the stacks have grown to
+			 *
+			 * 	@version 0.1
+			 */
+			void reset() {
+				this->stack.clear();
+				this->keys.clear();
+				this->root = this->traits.makeNull();
+				this->complete = false;
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			virtual ~JSONBasicBuilder() { }
+
+		protected:
+			/// Makes the values
+			Traits traits;
+
+			/// Objects and arrays that are still open, innermost last
+			std::vector<Value> stack;
+
+			/// The key of the member being read for each open object, innermost last
+			std::vector<Key> keys;
+
+			/// The outermost value, once finished
+			Value root;
+
+			/// If root has been finished
+			bool complete;
+
+			/**
+			 * 	@brief	Place a finished value into the innermost open container, or as the root
+			 *
+			 * 	@param	Value&&		The finished value
+			 *
+			 * 	@version 0.1
+			 */
+			void add(Value&& value) {
+				// The outermost value is finished
+				if(this->stack.empty()) {
+					this->root = std::move(value);
+					this->complete = true;
+				}
+				// Members of objects are paired with the last key read
+				else if(Object* object = Traits::getObject(this->stack.back()))
+					object->emplace(std::move(this->keys.back()), std::move(value));
+				else
+					Traits::getArray(this->stack.back()).push_back(std::move(value));
+			}
+	};
+
+	/// Builds a JSONValue from events
+	using JSONBuilder = JSONBasicBuilder<JSONValueTraits>;
+
+	// Built once, in json_event_handler.cpp
+	extern template class JSONBasicBuilder<JSONValueTraits>;
+}
+#endif
@@ -0,0 +1,454 @@
+/**
+ *  @file		json_fields.h
+ *  @brief	  Declare a type's json fields once and have its reading and writing built at compile time
+ *
+ * 	A type lists its members with JSON_FIELDS, which gives it a constexpr
+ * 	tuple of fields, each the member's name, a hash of the name and a
+ * 	pointer to the member.  JSONFields walks the tuple with fold expressions,
+ * 	so writing a type is a straight line of writer calls with the keys known
+ * 	at compile time, and reading one compares a member's hash with constants
+ * 	before its name.  There is no virtual call, and writing builds no JSON map.
+ *
+ * 		struct Point {
+ * 			int x;
+ * 			double y;
+ * 			std::vector<std::string> tags;
+ *
+ * 			JSON_FIELDS(Point, x, y, tags)
+ * 		};
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_FIELDS_H
+#define JSON_FIELDS_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "json_exception.h"
+#include "json_writer.h"
+#include "jsonable.h"
+
+/**
+ * 	@brief	Declare the json fields of a type, inside the type's body
+ *
+ * 	Each field is written with its member's name as the key.  Up to 32 fields
+ * 	can be listed, the members may be private.
+ *
+ * 	@param	Type		The type being declared in
+ * 	@param	...		The members, in the order they are written
+ */
+#define JSON_FIELDS(Type, ...) \
+	friend class ::json::JSONFields; \
+	static constexpr auto jsonFields() { \
+		using JSONFieldOwner = Type; \
+		return std::make_tuple(JSON_UTIL_CONCAT(JSON_UTIL_FIELDS_, JSON_UTIL_COUNT(__VA_ARGS__))(__VA_ARGS__)); \
+	}
+
+/**
+ * 	@brief	Declare the json fields of a JSONAble type, and implement getJSON and writeJSON with them
+ *
+ * 	@param	Type		The type being declared in
+ * 	@param	...		The members, in the order they are written
+ */
+#define JSON_ABLE_FIELDS(Type, ...) \
+	JSON_FIELDS(Type, __VA_ARGS__) \
+	virtual ::json::JSON getJSON() const override { \
+		return ::json::JSONFields::toJSON(*this); \
+	} \
+	virtual void writeJSON(::json::JSONWriter& writer) const override { \
+		::json::JSONFields::write(writer, *this); \
+	}
+
+// Helpers of JSON_FIELDS, which repeat JSON_UTIL_FIELD for each member
+#define JSON_UTIL_FIELD(member) ::json::JSONFields::field(#member, &JSONFieldOwner::member)
+#define JSON_UTIL_CONCAT(a, b) JSON_UTIL_CONCAT_(a, b)
+#define JSON_UTIL_CONCAT_(a, b) a##b
+#define JSON_UTIL_COUNT(...) JSON_UTIL_COUNT_(__VA_ARGS__, \
+		32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, \
+		16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1)
+#define JSON_UTIL_COUNT_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, \
+		_17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, N, ...) N
+#define JSON_UTIL_FIELDS_1(f) JSON_UTIL_FIELD(f)
+#define JSON_UTIL_FIELDS_2(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_1(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_3(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_2(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_4(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_3(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_5(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_4(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_6(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_5(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_7(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_6(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_8(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_7(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_9(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_8(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_10(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_9(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_11(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_10(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_12(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_11(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_13(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_12(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_14(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_13(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_15(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_14(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_16(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_15(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_17(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_16(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_18(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_17(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_19(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_18(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_20(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_19(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_21(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_20(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_22(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_21(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_23(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_22(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_24(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_23(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_25(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_24(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_26(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_25(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_27(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_26(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_28(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_27(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_29(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_28(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_30(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_29(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_31(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_30(__VA_ARGS__)
+#define JSON_UTIL_FIELDS_32(f, ...) JSON_UTIL_FIELD(f), JSON_UTIL_FIELDS_31(__VA_ARGS__)
+
+namespace json {
+	/**
+	 * 	@class		JSONFields
+	 * 	@brief		Purely static class that reads and writes types declared with JSON_FIELDS
+	 *
+	 * 	-Fields may be bool, any integer or floating point type, std::string,
+	 * 	std::vector of a field type, JSONValue, JSON, JSONArray, or another
+	 * 	type declared with JSON_FIELDS
+	 * 	-Reading ignores members that are not fields, and leaves fields that
+	 * 	are not members as they were
+	 *
+	 */
+	class JSONFields {
+		public:
+			/**
+			 * 	@struct		Field
+			 * 	@brief		One member of an Owner, as it is named in json
+			 *
+			 */
+			template <typename Owner, typename Member>
+			struct Field {
+				/// The key
+				std::string_view name;
+
+				/// JSONFields::hash of name
+				std::size_t hash;
+
+				/// The member
+				Member Owner::* member;
+			};
+
+			/// If a type was declared with JSON_FIELDS
+			template <typename T, typename = void>
+			struct IsReflected : std::false_type { };
+
+			/// If a type was declared with JSON_FIELDS
+			template <typename T>
+			struct IsReflected<T, std::void_t<decltype(T::jsonFields())>> : std::true_type { };
+
+			/// If a type is a std::vector
+			template <typename T>
+			struct IsVector : std::false_type { };
+
+			/// If a type is a std::vector
+			template <typename T, typename Allocator>
+			struct IsVector<std::vector<T, Allocator>> : std::true_type { };
+
+			/// FNV-1a hash of a key, usable at compile time
+			static constexpr std::size_t hash(std::string_view key) {
+				uint64_t h = 14695981039346656037ULL;
+				for(char c : key) {
+					h ^= static_cast<unsigned char>(c);
+					h *= 1099511628211ULL;
+				}
+				return static_cast<std::size_t>(h);
+			}
+
+			/// Build a field, the name is hashed at compile time
+			template <typename Owner, typename Member>
+			static constexpr Field<Owner, Member> field(std::string_view name, Member Owner::* member) {
+				return Field<Owner, Member>{name, JSONFields::hash(name), member};
+			}
+
+			/// The fields of a type, built with their hashes at compile time
+			template <typename T>
+			static constexpr auto FIELDS = T::jsonFields();
+
+			/// Get the fields of a type, in the order they were declared
+			template <typename T>
+			static constexpr const auto& getFields() {
+				return JSONFields::FIELDS<T>;
+			}
+
+			/**
+			 * 	@brief	Write an object's fields as a json object
+			 *
+			 * 	@param	JSONWriter&		The writer
+			 * 	@param	const T&		The object
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename T>
+			static void write(JSONWriter& writer, const T& object) {
+				writer.beginObject();
+				std::apply([&](const auto&... fields) {
+					((writer.key(fields.name), JSONFields::writeValue(writer, object.*(fields.member))), ...);
+				}, JSONFields::getFields<T>());
+				writer.endObject();
+			}
+
+			/// Build the text of an object's fields
+			template <typename T>
+			static std::string serialize(const T& object, bool compact = false) {
+				JSONWriter writer(compact);
+				JSONFields::write(writer, object);
+				return writer.takeText();
+			}
+
+			/**
+			 * 	@brief	Build a JSON map of an object's fields
+			 *
+			 * 	@param	const T&		The object
+			 * 	@return	JSON		A member for each field
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename T>
+			static JSON toJSON(const T& object) {
+				JSON j;
+				std::apply([&](const auto&... fields) {
+					j.reserve(sizeof...(fields));
+					(j.emplace(fields.name, JSONFields::toValue(object.*(fields.member))), ...);
+				}, JSONFields::getFields<T>());
+				return j;
+			}
+
+			/**
+			 * 	@brief	Set an object's fields from the members of a JSON map
+			 *
+			 * 	@param	const JSON&		The map
+			 * 	@param	T&		The object
+			 * 	@throw	  JSONException		  If a member does not fit its field
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename T>
+			static void read(const JSON& j, T& object) {
+				for(const auto& member : j)
+					JSONFields::readMember(member.first.view(), member.second, object);
+			}
+
+			/// Build an object from the members of a JSON map
+			template <typename T>
+			static T fromJSON(const JSON& j) {
+				T object{};
+				JSONFields::read(j, object);
+				return object;
+			}
+
+			/**
+			 * 	@brief	Set the field of an object named by a key
+			 *
+			 * 	The key's hash is compared with each field's, and only a field with
+			 * 	the same hash compares names
+			 *
+			 * 	@param	std::string_view		The key
+			 * 	@param	const JSONValue&		The value
+			 * 	@param	T&		The object
+			 * 	@return	bool		If the key named a field
+			 * 	@throw	  JSONException		  If the value does not fit the field
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename T>
+			static bool readMember(std::string_view key, const JSONValue& value, T& object) {
+				const std::size_t h = JSONFields::hash(key);
+				return std::apply([&](const auto&... fields) {
+					return ((fields.hash == h && fields.name == key &&
+							(JSONFields::readValue(value, object.*(fields.member), fields.name), true)) || ...);
+				}, JSONFields::getFields<T>());
+			}
+
+			/// Write one field's value
+			template <typename M>
+			static void writeValue(JSONWriter& writer, const M& value) {
+				if constexpr(IsReflected<M>::value)
+					JSONFields::write(writer, value);
+				else if constexpr(JSONFields::IsVector<M>::value) {
+					writer.beginArray();
+					for(const auto& element : value)
+						JSONFields::writeValue(writer, element);
+					writer.endArray();
+				}
+				else if constexpr(std::is_same_v<M, bool>)
+					writer.value(value);
+				else if constexpr(std::is_integral_v<M> && std::is_signed_v<M>)
+					writer.value(static_cast<int64_t>(value));
+				else if constexpr(std::is_integral_v<M>)
+					writer.value(static_cast<uint64_t>(value));
+				else if constexpr(std::is_floating_point_v<M>)
+					writer.value(static_cast<double>(value));
+				else
+					writer.value(value);
+			}
+
+			/// Convert one field's value to a JSONValue
+			template <typename M>
+			static JSONValue toValue(const M& value) {
+				if constexpr(IsReflected<M>::value)
+					return JSONObject(JSONFields::toJSON(value));
+				else if constexpr(JSONFields::IsVector<M>::value) {
+					JSONArray array;
+					array.reserve(value.size());
+					for(const auto& element : value)
+						array.push_back(JSONFields::toValue(element));
+					return array;
+				}
+				else if constexpr(std::is_same_v<M, bool>)
+					return value;
+				// Integers are held the way the parser would hold them, as an int if they fit
+				else if constexpr(std::is_integral_v<M> && std::is_signed_v<M>) {
+					if(value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())
+						return static_cast<int>(value);
+					return static_cast<int64_t>(value);
+				}
+				else if constexpr(std::is_integral_v<M>) {
+					if(value <= static_cast<unsigned int>(std::numeric_limits<int>::max()))
+						return static_cast<int>(value);
+					if(value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+						return static_cast<int64_t>(value);
+					return static_cast<uint64_t>(value);
+				}
+				else if constexpr(std::is_floating_point_v<M>)
+					return static_cast<double>(value);
+				else if constexpr(std::is_same_v<M, JSON>)
+					return JSONObject(value);
+				else
+					return JSONValue(value);
+			}
+
+			/**
+			 * 	@brief	Set one field from a value
+			 *
+			 * 	Numbers convert to any number field that holds them, an integer field
+			 * 	only taking whole numbers in its range.  Everything else must match
+			 *
+			 * 	@param	const JSONValue&		The value
+			 * 	@param	M&		The field
+			 * 	@param	std::string_view		Name of the field, for errors
+			 * 	@throw	  JSONException		  If the value does not fit the field
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename M>
+			static void readValue(const JSONValue& value, M& out, std::string_view name) {
+				if constexpr(IsReflected<M>::value) {
+					if(!std::holds_alternative<JSONObject>(value))
+						JSONFields::wrongType(name);
+					JSONFields::read(std::get<JSONObject>(value), out);
+				}
+				else if constexpr(JSONFields::IsVector<M>::value) {
+					if(!std::holds_alternative<JSONArray>(value))
+						JSONFields::wrongType(name);
+					const JSONArray& array = std::get<JSONArray>(value);
+					out.clear();
+					out.reserve(array.size());
+					for(const JSONValue& element : array) {
+						// Elements are read on their own, std::vector<bool> has no references to them
+						typename M::value_type item{};
+						JSONFields::readValue(element, item, name);
+						out.push_back(std::move(item));
+					}
+				}
+				else if constexpr(std::is_same_v<M, bool>) {
+					if(!std::holds_alternative<bool>(value))
+						JSONFields::wrongType(name);
+					out = std::get<bool>(value);
+				}
+				else if constexpr(std::is_arithmetic_v<M>) {
+					if(const int* number = std::get_if<int>(&value))
+						JSONFields::readNumber(*number, out, name);
+					else if(const double* number = std::get_if<double>(&value))
+						JSONFields::readNumber(*number, out, name);
+					else if(const int64_t* number = std::get_if<int64_t>(&value))
+						JSONFields::readNumber(*number, out, name);
+					else if(const uint64_t* number = std::get_if<uint64_t>(&value))
+						JSONFields::readNumber(*number, out, name);
+					else
+						JSONFields::wrongType(name);
+				}
+				else if constexpr(std::is_same_v<M, std::string>) {
+					if(!std::holds_alternative<std::string>(value))
+						JSONFields::wrongType(name);
+					out = std::get<std::string>(value);
+				}
+				else if constexpr(std::is_same_v<M, JSON> || std::is_same_v<M, JSONObject>) {
+					if(!std::holds_alternative<JSONObject>(value))
+						JSONFields::wrongType(name);
+					out = std::get<JSONObject>(value);
+				}
+				else if constexpr(std::is_same_v<M, JSONArray>) {
+					if(!std::holds_alternative<JSONArray>(value))
+						JSONFields::wrongType(name);
+					out = std::get<JSONArray>(value);
+				}
+				else {
+					static_assert(std::is_same_v<M, JSONValue>, "Type of a json field is not supported");
+					out = value;
+				}
+			}
+
+		protected:
+			/// Throw the error for a value that does not fit its field
+			[[noreturn]] static void wrongType(std::string_view name) {
+				throw JSONException("Json value has the wrong type for the field: " + std::string(name));
+			}
+
+			/**
+			 * 	@brief	Check if a number can be held by a number field
+			 *
+			 * 	@param	N		The number, an int, int64_t, uint64_t or double
+			 * 	@return	bool		If M holds it, exactly if M is an integer
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename M, typename N>
+			static bool fits(N number) {
+				if constexpr(std::is_floating_point_v<M>) {
+					if constexpr(std::is_floating_point_v<N>)
+						return number >= std::numeric_limits<M>::lowest() && number <= std::numeric_limits<M>::max();
+					return true;
+				}
+				else if constexpr(std::is_floating_point_v<N>) {
+					// The bounds are 0 or powers of two, which a double holds exactly
+					const N limit = static_cast<N>(std::numeric_limits<M>::max() / 2 + 1) * 2;
+					return number == std::trunc(number) &&
+							number >= static_cast<N>(std::numeric_limits<M>::min()) && number < limit;
+				}
+				else if constexpr(std::is_signed_v<N>) {
+					if(number < 0)
+						return std::is_signed_v<M> &&
+								static_cast<int64_t>(number) >= static_cast<int64_t>(std::numeric_limits<M>::min());
+					return static_cast<uint64_t>(number) <= static_cast<uint64_t>(std::numeric_limits<M>::max());
+				}
+				else
+					return number <= static_cast<uint64_t>(std::numeric_limits<M>::max());
+			}
+
+			/// Set a number field, throw a JSONException if it cannot hold the number
+			template <typename M, typename N>
+			static void readNumber(N number, M& out, std::string_view name) {
+				if(!JSONFields::fits<M>(number))
+					JSONFields::wrongType(name);
+				out = static_cast<M>(number);
+			}
+	};
+}
+#endif
@@ -0,0 +1,289 @@
+/**
+ *  @file		json_file.h
+ *  @brief	  Handle the reading and writing of files in json
+ *  
+ * 	-Files are read in as and returned as std::strings
+ * 	-Files are taken in as a JSON map and written out as valid json
+ *  
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  07-29-2018
+ *  @version	0.3
+ */
+
+#ifndef JSON_FILE_H
+#define JSON_FILE_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fstream>
+
+#include "json_arena_document.h"
+#include "json_event_parser.h"
+#include "json_exception.h"
+#include "json_lazy_document.h"
+#include "json_mapped_file.h"
+#include "json_text_parser.h"
+#include "json_thread_pool.h"
+#include "json_parser.h"
+
+namespace json {
+	/**
+	 * 	@class		JSONFile
+	 * 	@brief		Purely static class that reads / writes json files
+	 * 
+	 * 	-read: filename (std::string) -> jsonString (std::string)
+	 * 	-write: filename (std::string), jsonString (std::string) -> bool
+	 * 
+	 */
+	class JSONFile {
+		public:
+			/// File extension for a json file
+			static std::string FILE_EXTENSION;
+
+			/// File extension for a newline delimited json file, one object per line
+			static std::string LINES_FILE_EXTENSION;
+
+			/// Number of characters read at a time when streaming a file
+			static std::size_t CHUNK_SIZE;
+
+			/**
+			 * 	@brief	Default Constructor
+			 * 
+			 * 	(Does nothing purely static class)
+			 * 
+			 * 	@version	0.1
+			 */
+			JSONFile();
+
+			/**
+			 * 	@brief	Copy Constructor
+			 * 
+			 * 	(Does Nothing, purley static class)
+			 * 
+			 * 	@version	0.1
+			 */
+			JSONFile(JSONFile& copy);
+
+			/**
+			 * 	@brief 	Read the contents of the file, parse the JSON, and return
+			 * 
+			 * 	Memory map the file, and parse the json with JSONTextParser straight from the mapping
+			 * 
+			 * 	@param 	std::string				filename 
+			 * 	@return   JSON 						JSON representation
+			 * 	@throw	  JSONException	   If there is an error reading the file or parsing it
+			 * 
+			 * 	@version 0.5
+			 */
+			static JSON readJSON(std::string filename);
+
+			/**
+			 * 	@brief 	Read the contents of the file, parsing its members in parallel on the pool
+			 * 
+			 * 	Memory map the file, and parse it with JSONTextParser::parseParallel
+			 * 
+			 * 	@param 	std::string				filename 
+			 * 	@param	JSONThreadPool&		Pool the members are parsed on
+			 * 	@return   JSON 						JSON representation
+			 * 	@throw	  JSONException	   If there is an error reading the file or parsing it
+			 * 
+			 * 	@version 0.1
+			 */
+			static JSON readJSON(std::string filename, JSONThreadPool& pool);
+
+			/**
+			 * 	@brief 	Read the contents of the file into a document that is only parsed as it is used
+			 * 
+			 * 	The text is validated, but values are only built when they are looked up
+			 * 
+			 * 	@param 	std::string				filename 
+			 * 	@return   JSONLazyDocument	  The validated, unparsed document
+			 * 	@throw	  JSONException	   If there is an error reading the file or it is not valid json
+			 * 
+			 * 	@version 0.1
+			 */
+			static JSONLazyDocument readLazy(std::string filename);
+
+			/**
+			 * 	@brief 	Read the contents of the file into a document allocated from its own arena
+			 * 
+			 * 	@param 	std::string				filename 
+			 * 	@return   JSONArenaDocument	 The parsed document
+			 * 	@throw	  JSONException	   If there is an error reading the file or parsing it
+			 * 
+			 * 	@version 0.1
+			 */
+			static JSONArenaDocument readArena(std::string filename);
+
+			/**
+			 * 	@brief 	Stream the file through a JSONEventParser, reporting it to the handler
+			 * 
+			 * 	The file is read CHUNK_SIZE characters at a time, so files of any size
+			 * 	can be read in constant memory
+			 * 
+			 * 	@param 	std::string				filename 
+			 * 	@param	JSONEventHandler&	 The handler the contents are reported to
+			 * 	@throw	  JSONException	   If there is an error reading the file or parsing it
+			 * 
+			 * 	@version 0.1
+			 */
+			static void readEvents(std::string filename, JSONEventHandler& handler);
+
+			/**
+			 * 	@brief 	Read a newline delimited json file, handing each record to the callback in order
+			 * 
+			 * 	The file is memory mapped and its lines parsed in parallel batches on the pool,
+			 * 	see JSONTextParser::parseLines
+			 * 
+			 * 	@param 	std::string								filename, w/ or w/out .ndjson
+			 * 	@param	std::function<void(JSON&)>		 Called with each record in order
+			 * 	@param	JSONThreadPool&						Pool the lines are parsed on
+			 * 	@throw	  JSONException	   If there is an error reading the file or parsing a line
+			 * 
+			 * 	@version 0.1
+			 */
+			static void readLines(std::string filename, const std::function<void(JSON&)>& onRecord,
+					JSONThreadPool& pool = JSONThreadPool::getShared());
+
+			/**
+			 * 	@brief 	Append records to a newline delimited json file, one compact line each
+			 * 
+			 * 	The file is created if it does not exist, existing records are left as they are
+			 * 
+			 * 	@param 	std::string						filename, w/ or w/out .ndjson
+			 * 	@param	const std::vector<JSON>&	 The records being appended
+			 * 	@return   bool								 Whether or not the write suceeded
+			 * 	@throw	  JSONException			   If there was an error during writing
+			 * 
+			 * 	@version 0.1
+			 */
+			static bool appendLines(std::string filename, const std::vector<JSON>& records);
+
+			/**
+			 * 	@brief 	Append one record to a newline delimited json file
+			 * 
+			 * 	@param 	std::string						filename, w/ or w/out .ndjson
+			 * 	@param	const JSON&					  The record being appended
+			 * 	@return   bool								 Whether or not the write suceeded
+			 * 	@throw	  JSONException			   If there was an error during writing
+			 * 
+			 * 	@version 0.1
+			 */
+			static bool appendLine(std::string filename, const JSON& record);
+
+			/**
+			 * 	@brief 	Write the json-text for the JSON object passed into a file
+			 * 
+			 * 	Construct the json-text from the JSON object and write it to a file
+			 * 	using the internal write method
+			 * 
+			 * 	@param 	std::string						filename 
+			 * 	@param	const JSON&					  The JSON being written, which is not copied
+			 * 	@return   bool								 Whether or not the write suceeded
+			 * 	@throw	  JSONException			   If there was an error during writing
+			 * 
+			 * 	@version 0.2
+			 */
+			static bool writeJSON(std::string filename, const JSON& j);
+
+			/**
+			 * 	@brief 	Write the json-text for the JSON object passed into a file, formatting its members in parallel
+			 * 
+			 * 	The members are formatted with JSONSerializer::writeParallel, and the chunks
+			 * 	written to the file together with writev as they finish
+			 * 
+			 * 	@param 	std::string						filename 
+			 * 	@param	const JSON&					  The JSON being written, which is not copied
+			 * 	@param	JSONThreadPool&				Pool the members are formatted on
+			 * 	@return   bool								 Whether or not the write suceeded
+			 * 	@throw	  JSONException			   If there was an error during writing
+			 * 
+			 * 	@version 0.1
+			 */
+			static bool writeJSON(std::string filename, const JSON& j, JSONThreadPool& pool);
+
+			/**
+			 * 	@brief 	Write the json-text for the JSONAble object passed into a file
+			 * 
+			 * 	The object writes itself to the file through its writeJSON hook, so
+			 * 	one that overrides it is never held as a JSON map
+			 * 
+			 * 	@param 	std::string						filename 
+			 * 	@param	const JSONAble&			  The JSONAble object being written
+			 * 	@return   bool								 Whether or not the write suceeded
+			 * 	@throw	  JSONException			   If there was an error during writing
+			 * 
+			 * 	@version 0.2
+			 */
+			static bool writeJSON(std::string filename, const JSONAble& object);
+
+			/**
+			 * 	@brief	Read in a file (filename) and return its text in a single string to be parsed
+			 * 
+			 * 	-If the filename doesn't have an .json extension, add it and then read in the file
+			 * 	-From there map the file and copy it, unchanged, into the string returned
+			 * 
+			 * 	@param	std::string			  Name of file that is being read in w/ or w/out .json
+			 * 
+			 * 	@return   std::string	  		The JSON read from the file
+			 * 	@throw	  JSONException	  if there is an error reading the file
+			 * 
+			 * 	@version 0.5
+			 */
+			static std::string read(std::string filename);
+
+			/**
+			 * 	@brief	Write the text that is in a json form to the file (filename)
+			 * 
+			 * 	-If the filename is missing .json extension add it, then write to the file
+			 * 	
+			 * 	@param	std::string				Name of the file to write to w/ or w/out file extension
+			 * 	@param	std::string				The data getting written to the file in a json format
+			 * 
+			 * 	@return	  bool						Did the data get written correctly
+			 * 	@throw	  JSONException		If there was an error writing the data
+			 *  
+			 * 	@version 0.1
+			 */
+			static bool write(std::string filename, std::string text);
+
+			/**
+			 * 	@brief	Destructor
+			 * 
+			 * 	Details
+			 * 
+			 * 	@version 0.1
+			 */
+			~JSONFile();
+
+		private:
+			/**
+			 * 	@brief	Check if the given filename has the file extension
+			 * 
+			 * 	Details
+			 * 
+			 * 	@param	std::string			Name of the file
+			 * 
+			 * 	@return	  bool					If the file has the correct FILE_EXTENSION at the end
+			 * 
+			 * 	@version 0.1
+			 */
+			static bool checkExtension(std::string filename);
+
+			/**
+			 * 	@brief	Check if the given filename ends with the extension
+			 * 
+			 * 	@param	const std::string&		Name of the file
+			 * 	@param	const std::string&		The extension expected
+			 * 
+			 * 	@return	  bool					If the file has the extension at the end
+			 * 
+			 * 	@version 0.1
+			 */
+			static bool checkExtension(const std::string& filename, const std::string& extension);
+	};
+}
+#endif
\ No newline at end of file
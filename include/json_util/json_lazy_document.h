@@ -0,0 +1,252 @@
+/**
+ *  @file		json_lazy_document.h
+ *  @brief	  Read values out of json text only when they are asked for
+ *
+ * 	A JSONLazyDocument checks that its text is valid json once, but builds
+ * 	nothing.  JSONLazyValues are views of a single value inside of the text,
+ * 	looking up a key or index skips over every sibling by matching brackets,
+ * 	and only the value that is finally materialized is parsed into a JSONValue
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_LAZY_DOCUMENT_H
+#define JSON_LAZY_DOCUMENT_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "json_cursor.h"
+#include "json_exception.h"
+#include "jsonable.h"
+
+namespace json {
+
+	/**
+	 * 	@class		JSONLazyValue
+	 * 	@brief		A view of one value inside of a JSONLazyDocument's text
+	 *
+	 * 	A value that was looked up but does not exist can still be indexed, so
+	 * 	chains like doc["a"]["b"][2] never throw until materialize() is called
+	 *
+	 */
+	class JSONLazyValue {
+		public:
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	Build a value that does not exist
+			 *
+			 * 	@version	0.1
+			 */
+			JSONLazyValue();
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	@param	std::string_view		Text of exactly one valid json value
+			 *
+			 * 	@version	0.1
+			 */
+			JSONLazyValue(std::string_view text);
+
+			/**
+			 * 	@brief	Check if the value was found
+			 *
+			 * 	@return	bool		If the value exists in the document
+			 */
+			bool exists() const {
+				return !this->text.empty();
+			}
+
+			/// If the value is an object
+			bool isObject() const {
+				return this->exists() && this->text.front() == '{';
+			}
+
+			/// If the value is an array
+			bool isArray() const {
+				return this->exists() && this->text.front() == '[';
+			}
+
+			/// If the value is a string
+			bool isString() const {
+				return this->exists() && (this->text.front() == '"' || this->text.front() == '\'');
+			}
+
+			/// If the value is null
+			bool isNull() const {
+				return this->text == "null";
+			}
+
+			/**
+			 * 	@brief	Find the member of this object with the key
+			 *
+			 * 	Members before it are skipped without being built
+			 *
+			 * 	@param	std::string_view		The key to look for
+			 * 	@return   JSONLazyValue			  The member, which does not exist if not found
+			 *
+			 * 	@version 0.1
+			 */
+			JSONLazyValue operator[](std::string_view key) const;
+
+			/// Find the member of this object with the key
+			JSONLazyValue operator[](const char* key) const {
+				return (*this)[std::string_view(key)];
+			}
+
+			/**
+			 * 	@brief	Find the element of this array at the index
+			 *
+			 * 	Elements before it are skipped without being built
+			 *
+			 * 	@param	std::size_t				  Index of the element
+			 * 	@return   JSONLazyValue			  The element, which does not exist if out of range
+			 *
+			 * 	@version 0.1
+			 */
+			JSONLazyValue operator[](std::size_t index) const;
+
+			/// Find the element of this array at the index
+			JSONLazyValue operator[](int index) const {
+				return (index < 0) ? JSONLazyValue() : (*this)[static_cast<std::size_t>(index)];
+			}
+
+			/**
+			 * 	@brief	Count the members of an object or elements of an array
+			 *
+			 * 	@return	std::size_t		The count, 0 for anything that is not a container
+			 *
+			 * 	@version 0.1
+			 */
+			std::size_t size() const;
+
+			/**
+			 * 	@brief	Parse the value and everything in it
+			 *
+			 * 	@return	JSONValue			  The value
+			 * 	@throw	  JSONException	   If the value does not exist
+			 *
+			 * 	@version 0.1
+			 */
+			JSONValue materialize() const;
+
+			/**
+			 * 	@brief	Parse the value and get it as the type T
+			 *
+			 * 	@return	T							 The value
+			 * 	@throw	  JSONException	   If the value does not exist
+			 * 	@throw	  std::bad_variant_access	If the value is not a T
+			 */
+			template <typename T>
+			T get() const {
+				return std::get<T>(this->materialize());
+			}
+
+			/**
+			 * 	@brief	Get the json text of the value
+			 *
+			 * 	@return	std::string_view		The text, empty if it does not exist
+			 */
+			std::string_view getText() const {
+				return this->text;
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONLazyValue();
+
+		protected:
+			/// The text of the value, with no surrounding whitespace
+			std::string_view text;
+
+			/**
+			 * 	@brief	Build a value from the text between the cursor and the end of the next value
+			 *
+			 * 	@param	JSONCursor&			 Cursor on (or whitespace before) the value
+			 * 	@return	  JSONLazyValue		  View of the value, the cursor is moved past it
+			 *
+			 * 	@version 0.1
+			 */
+			static JSONLazyValue skipToNext(JSONCursor& s);
+	};
+
+	/**
+	 * 	@class		JSONLazyDocument
+	 * 	@brief		Own json text that has been validated but not parsed
+	 *
+	 * 	JSONLazyValues taken from the document view its text, so they must not
+	 * 	outlive it, and must be taken again after the document is moved
+	 *
+	 */
+	class JSONLazyDocument {
+		public:
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Take the text and check that it holds exactly one valid json value
+			 *
+			 * 	@param	std::string			   The json text
+			 * 	@throw	  JSONException	   If the text is not valid json
+			 *
+			 * 	@version	0.1
+			 */
+			JSONLazyDocument(std::string text);
+
+			/**
+			 * 	@brief	Get the value the whole document holds
+			 *
+			 * 	@return	JSONLazyValue		The root value
+			 *
+			 * 	@version 0.1
+			 */
+			JSONLazyValue getRoot() const;
+
+			/// Find the member of the root object with the key
+			JSONLazyValue operator[](std::string_view key) const {
+				return this->getRoot()[key];
+			}
+
+			/// Find the member of the root object with the key
+			JSONLazyValue operator[](const char* key) const {
+				return this->getRoot()[std::string_view(key)];
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONLazyDocument();
+
+		protected:
+			/// The json text of the document
+			std::string text;
+
+			/**
+			 * 	@brief	Check the next value follows the json grammar, without building it
+			 *
+			 * 	Escapes in keys and strings are read too, so a broken one throws
+			 * 	here and not when the value is looked up
+			 *
+			 * 	@param	JSONCursor&			 Cursor on (or whitespace before) the value
+			 * 	@param	std::string&		 Scratch space the strings with escapes are unescaped into
+			 * 	@throw	  JSONException		  If the value is not valid
+			 *
+			 * 	@version 0.1
+			 */
+			static void validate(JSONCursor& s, std::string& scratch);
+	};
+}
+#endif
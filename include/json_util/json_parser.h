@@ -0,0 +1,147 @@
+/**
+ *  @file		json_parser.h
+ *  @brief	  Describes how to build a json string from a JSON object
+ *  
+ * 	Every kind of document is handed to JSONSerializer, which builds the
+ *  text in one buffer
+ *  
+ *  @author	  Gabriel Shelton	sheltongabe
+ *  @date		07-31-2018
+ *  @version  0.5
+ */
+
+#ifndef JSON_PARSER_H
+#define JSON_PARSER_H
+
+#include <string>
+
+#include "json_compact_value.h"
+#include "json_persistent_document.h"
+#include "json_tape.h"
+#include "jsonable.h"
+
+
+namespace json {
+	/**
+	 * 	@class		JSONParser
+	 * 	@brief		A pure static class that describes how to convert objects to json strings
+	 * 
+	 * 	Uses JSONSerializer to form the json string
+	 * 
+	 */
+	class JSONParser {
+		public:
+			/**
+			 * 	@brief	Default Constructor
+			 * 
+			 * 	Details
+			 * 
+			 * 	@version	0.1
+			 */
+			JSONParser();
+
+			/**
+			 * 	@brief	Copy Constructor
+			 * 
+			 * 	Details
+			 * 
+			 * 	@version	0.1
+			 */
+			JSONParser(JSONParser& copy);
+
+			/**
+			 * 	@brief	Destructor
+			 * 
+			 * 	Details
+			 * 
+			 * 	@version	0.1
+			 */
+			~JSONParser();
+
+			/**
+			 * 	@brief 	Take a JSON and build a string
+			 * 
+			 * 	Call a recursive method that will start to build the JSON string
+			 * 
+			 * 	@param	const JSON&			JSON object to build the text from, which is not copied
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.2
+			 */
+			static std::string parse(const JSON& j);
+
+			/**
+			 * 	@brief 	Take a JSON and build a string on a single line, with no whitespace
+			 * 
+			 * 	@param	const JSON&			JSON object to build the text from, which is not copied
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.6
+			 */
+			static std::string parseCompact(const JSON& j);
+
+			/**
+			 * 	@brief 	Take a JSONCompactValue and build a string, formatted like parse
+			 * 
+			 * 	@param	const JSONCompactValue&		Value to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parse(const JSONCompactValue& value);
+
+			/**
+			 * 	@brief 	Take a JSONCompactValue and build a string on a single line, with no whitespace
+			 * 
+			 * 	@param	const JSONCompactValue&		Value to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parseCompact(const JSONCompactValue& value);
+
+			/**
+			 * 	@brief 	Take a JSONPersistentDocument and build a string, formatted like parse
+			 * 
+			 * 	@param	const JSONPersistentDocument&		Version of the document to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parse(const JSONPersistentDocument& document);
+
+			/**
+			 * 	@brief 	Take a JSONPersistentDocument and build a string on a single line, with no whitespace
+			 * 
+			 * 	@param	const JSONPersistentDocument&		Version of the document to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parseCompact(const JSONPersistentDocument& document);
+
+			/**
+			 * 	@brief 	Take a JSONTape and build a string, formatted like parse
+			 * 
+			 * 	@param	const JSONTape&		Tape to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parse(const JSONTape& tape);
+
+			/**
+			 * 	@brief 	Take a JSONTape and build a string on a single line, with no whitespace
+			 * 
+			 * 	@param	const JSONTape&		Tape to build the text from
+			 * 	@return  std::string 	The json string built
+			 * 
+			 * 	@version 0.1
+			 */
+			static std::string parseCompact(const JSONTape& tape);
+
+		private:
+
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,493 @@
+/**
+ *  @file		json_persistent_map.h
+ *  @brief	  An immutable, insertion ordered map whose versions share everything but the paths to what changed
+ *
+ * 	The members are kept in the order they were added in a
+ * 	JSONPersistentVector, and a hash array mapped trie maps each key to its
+ * 	position there.  The trie takes the hash of a key 5 bits at a time, each
+ * 	node holding a 32 bit map of the slots in use and only those slots, so
+ * 	finding, setting, adding or erasing a member copies one node per level of
+ * 	each structure and costs O(log n).  Erased members leave an empty slot in
+ * 	the order, which is packed away once most slots are empty
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_PERSISTENT_MAP_H
+#define JSON_PERSISTENT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json_key.h"
+#include "json_persistent_vector.h"
+
+namespace json {
+
+	/**
+	 * 	@class		JSONPersistentMap
+	 * 	@brief		An immutable map from JSONKey to Value in the order members were added, updates return a new version
+	 *
+	 * 	-Copies share both tries, they never copy them
+	 * 	-Lookups take a JSONKey or anything convertible to a std::string_view
+	 * 	-Comparing with == ignores the order of the members
+	 *
+	 */
+	template <typename Value>
+	class JSONPersistentMap {
+		public:
+			using key_type = JSONKey;
+			using mapped_type = Value;
+			using value_type = std::pair<JSONKey, Value>;
+			using size_type = std::size_t;
+
+		protected:
+			/// The members in order, an erased member leaves an empty slot
+			using Entries = JSONPersistentVector<std::optional<value_type>>;
+
+		public:
+			/**
+			 * 	@class		const_iterator
+			 * 	@brief		Walk the members in the order they were added, skipping empty slots
+			 *
+			 */
+			class const_iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = JSONPersistentMap::value_type;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const value_type*;
+					using reference = const value_type&;
+
+					/// Default Constructor
+					const_iterator() = default;
+
+					/// Initializing Constructor, the first member at or after a slot
+					const_iterator(typename Entries::const_iterator current, typename Entries::const_iterator end) :
+							current(current),
+							last(end) {
+						this->skip();
+					}
+
+					reference operator*() const { return **this->current; }
+					pointer operator->() const { return &**this->current; }
+
+					const_iterator& operator++() {
+						++this->current;
+						this->skip();
+						return *this;
+					}
+
+					const_iterator operator++(int) {
+						const_iterator previous = *this;
+						++*this;
+						return previous;
+					}
+
+					bool operator==(const const_iterator& other) const { return this->current == other.current; }
+					bool operator!=(const const_iterator& other) const { return this->current != other.current; }
+
+				protected:
+					/// The slot of the member
+					typename Entries::const_iterator current;
+
+					/// The end of the slots
+					typename Entries::const_iterator last;
+
+					/// Move past empty slots
+					void skip() {
+						while(this->current != this->last && !this->current->has_value())
+							++this->current;
+					}
+			};
+
+			/// Default Constructor, an empty map
+			JSONPersistentMap() :
+				count(0) { }
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Both tries are built from the bottom up, no path is copied.  Later
+			 * 	duplicates of a key are ignored
+			 *
+			 * 	@param	std::vector<value_type>		The members, in order
+			 *
+			 * 	@version	0.1
+			 */
+			explicit JSONPersistentMap(std::vector<value_type> members) :
+					count(0) {
+				std::vector<HashSlot> leaves;
+				leaves.reserve(members.size());
+				for(size_type i = 0; i < members.size(); ++i)
+					leaves.push_back(HashSlot{nullptr, members[i].first, members[i].first.getHash(), i});
+
+				std::vector<bool> duplicates(members.size(), false);
+				if(!leaves.empty())
+					this->hashRoot = JSONPersistentMap::build(leaves, 0, leaves.size(), 0, duplicates);
+
+				// A later duplicate leaves its slot empty, so the positions of the members after it hold
+				std::vector<std::optional<value_type>> slots(members.size());
+				for(size_type i = 0; i < members.size(); ++i) {
+					if(!duplicates[i]) {
+						slots[i].emplace(std::move(members[i]));
+						++this->count;
+					}
+				}
+				this->entries = Entries(std::move(slots));
+			}
+
+			// ----- Iteration, in the order members were added -----
+			const_iterator begin() const { return const_iterator(this->entries.begin(), this->entries.end()); }
+			const_iterator end() const { return const_iterator(this->entries.end(), this->entries.end()); }
+
+			/// Number of members
+			size_type size() const { return this->count; }
+
+			/// If there are no members
+			bool empty() const { return this->count == 0; }
+
+			/**
+			 * 	@brief	Find the member with the key
+			 *
+			 * 	@param	K		The key, a JSONKey or anything convertible to std::string_view
+			 * 	@return	const_iterator		The member, or end() if there is none
+			 */
+			template <typename K>
+			const_iterator find(const K& key) const {
+				const size_type position = this->findPosition(key);
+				if(position == JSONPersistentMap::NONE)
+					return this->end();
+				return const_iterator(typename Entries::const_iterator(&this->entries, position), this->entries.end());
+			}
+
+			/// If there is a member with the key
+			template <typename K>
+			bool contains(const K& key) const {
+				return this->findPosition(key) != JSONPersistentMap::NONE;
+			}
+
+			/**
+			 * 	@brief	Build the version with a member added, or the value of the member with the key replaced
+			 *
+			 * 	A replaced member keeps its place in the order, an added one goes last
+			 *
+			 * 	@param	JSONKey		The key
+			 * 	@param	Value		The value
+			 * 	@return	JSONPersistentMap		The new version
+			 *
+			 * 	@version 0.1
+			 */
+			JSONPersistentMap set(JSONKey key, Value value) const {
+				JSONPersistentMap result = *this;
+				const size_type hash = key.getHash();
+				const size_type position = JSONPersistentMap::findIn(this->hashRoot.get(), key, hash);
+				if(position != JSONPersistentMap::NONE) {
+					result.entries = this->entries.set(position, value_type(std::move(key), std::move(value)));
+					return result;
+				}
+
+				result.hashRoot = JSONPersistentMap::insert(this->hashRoot.get(), 0,
+						HashSlot{nullptr, key, hash, this->entries.size()});
+				result.entries = this->entries.append(value_type(std::move(key), std::move(value)));
+				++result.count;
+				return result;
+			}
+
+			/**
+			 * 	@brief	Build the version without the member with the key
+			 *
+			 * 	@param	K		The key, a JSONKey or anything convertible to std::string_view
+			 * 	@return	JSONPersistentMap		The new version, the same as this one if there is no such member
+			 *
+			 * 	@version 0.1
+			 */
+			template <typename K>
+			JSONPersistentMap erase(const K& key) const {
+				const size_type position = this->findPosition(key);
+				if(position == JSONPersistentMap::NONE)
+					return *this;
+
+				JSONPersistentMap result = *this;
+				const JSONKey& found = this->entries[position]->first;
+				result.hashRoot = JSONPersistentMap::remove(this->hashRoot.get(), 0, found, found.getHash());
+				result.entries = (position + 1 == this->entries.size()) ? this->entries.erase(position) :
+						this->entries.set(position, std::nullopt);
+				--result.count;
+
+				// Once most slots are empty the members are packed, which costs less than the erases that emptied them
+				if(result.entries.size() >= 2 * result.count + Entries::WIDTH) {
+					std::vector<value_type> members;
+					members.reserve(result.count);
+					for(const value_type& member : result)
+						members.push_back(member);
+					return JSONPersistentMap(std::move(members));
+				}
+				return result;
+			}
+
+			/// Same members with equal values, in any order
+			bool operator==(const JSONPersistentMap& other) const {
+				if(this->count != other.count)
+					return false;
+
+				// Versions of one map keep each key where it was, so they are compared slot by slot
+				const bool sameKeys = this->entries.matches(other.entries,
+						[](const std::optional<value_type>& left, const std::optional<value_type>& right) {
+					return left.has_value() == right.has_value() && (!left || left->first == right->first);
+				});
+				if(sameKeys) {
+					return this->entries.matches(other.entries,
+							[](const std::optional<value_type>& left, const std::optional<value_type>& right) {
+						return !left || left->second == right->second;
+					});
+				}
+
+				for(const value_type& member : *this) {
+					const_iterator found = other.find(member.first);
+					if(found == other.end() || !(member.second == found->second))
+						return false;
+				}
+				return true;
+			}
+
+			/// Differing members or values
+			bool operator!=(const JSONPersistentMap& other) const {
+				return !(*this == other);
+			}
+
+		protected:
+			/// Bits of the hash taken at each level
+			static constexpr size_type BITS = 5;
+
+			/// Bits in a hash, past them keys with the same hash share one node
+			static constexpr size_type HASH_BITS = 8 * sizeof(size_type);
+
+			/// The position of no member
+			static constexpr size_type NONE = ~size_type(0);
+
+			struct HashNode;
+
+			/// A slot of a node, a child node or the position of a key
+			struct HashSlot {
+				std::shared_ptr<const HashNode> child;
+				JSONKey key;
+				size_type hash;
+				size_type position;
+			};
+
+			/// A node of the trie, the slots in use in the order of their bits
+			struct HashNode {
+				uint32_t bitmap = 0;
+				std::vector<HashSlot> slots;
+			};
+
+			/// The members, in order
+			Entries entries;
+
+			/// The top of the trie of positions, nullptr when empty
+			std::shared_ptr<const HashNode> hashRoot;
+
+			/// Number of members
+			size_type count;
+
+			/// Find the position of the member with the key, or NONE
+			template <typename K>
+			size_type findPosition(const K& key) const {
+				if constexpr(std::is_same_v<K, JSONKey>)
+					return JSONPersistentMap::findIn(this->hashRoot.get(), key, key.getHash());
+				else
+					return JSONPersistentMap::findIn(this->hashRoot.get(), std::string_view(key),
+							std::hash<std::string_view>{}(std::string_view(key)));
+			}
+
+			/// Index of the slot for a bit among the slots in use
+			static size_type slotIndex(uint32_t bitmap, uint32_t bit) {
+				return __builtin_popcount(bitmap & (bit - 1));
+			}
+
+			/// The bit of a node's map a hash falls in, at a level
+			static uint32_t hashBit(size_type hash, size_type shift) {
+				return uint32_t(1) << ((hash >> shift) & 31);
+			}
+
+			/**
+			 * 	@brief	Find the position of a key, following its hash down from a node
+			 *
+			 * 	@param	const HashNode*		The node, nullptr for an empty trie
+			 * 	@param	const T&		The key, a JSONKey or std::string_view
+			 * 	@param	size_type		Hash of the key
+			 * 	@return	size_type		The position, or NONE
+			 */
+			template <typename T>
+			static size_type findIn(const HashNode* node, const T& key, size_type hash) {
+				for(size_type shift = 0; node != nullptr; shift += BITS) {
+					// Keys with the same hash are searched one by one
+					if(shift >= HASH_BITS) {
+						for(const HashSlot& slot : node->slots) {
+							if(slot.key == key)
+								return slot.position;
+						}
+						return JSONPersistentMap::NONE;
+					}
+
+					const uint32_t bit = JSONPersistentMap::hashBit(hash, shift);
+					if((node->bitmap & bit) == 0)
+						return JSONPersistentMap::NONE;
+
+					const HashSlot& slot = node->slots[JSONPersistentMap::slotIndex(node->bitmap, bit)];
+					if(!slot.child)
+						return (slot.hash == hash && slot.key == key) ? slot.position : JSONPersistentMap::NONE;
+					node = slot.child.get();
+				}
+				return JSONPersistentMap::NONE;
+			}
+
+			/**
+			 * 	@brief	Copy the path to where a key goes, with the key added
+			 *
+			 * 	A key landing on the slot of another is pushed down with it into a new node
+			 *
+			 * 	@param	const HashNode*		Node the path starts at, nullptr to start a new one
+			 * 	@param	size_type		Bits of the hash used above the node
+			 * 	@param	HashSlot		The key, which must not be in the trie yet
+			 * 	@return	std::shared_ptr<const HashNode>		The copy of the node
+			 */
+			static std::shared_ptr<const HashNode> insert(const HashNode* node, size_type shift, HashSlot leaf) {
+				auto copy = (node != nullptr) ? std::make_shared<HashNode>(*node) : std::make_shared<HashNode>();
+				if(shift >= HASH_BITS) {
+					copy->slots.push_back(std::move(leaf));
+					return copy;
+				}
+
+				const uint32_t bit = JSONPersistentMap::hashBit(leaf.hash, shift);
+				const size_type index = JSONPersistentMap::slotIndex(copy->bitmap, bit);
+				if((copy->bitmap & bit) == 0) {
+					copy->bitmap |= bit;
+					copy->slots.insert(copy->slots.begin() + index, std::move(leaf));
+					return copy;
+				}
+
+				HashSlot& slot = copy->slots[index];
+				if(!slot.child) {
+					HashSlot existing = std::move(slot);
+					slot = HashSlot{JSONPersistentMap::insert(nullptr, shift + BITS, std::move(existing)), JSONKey(), 0, 0};
+				}
+				slot.child = JSONPersistentMap::insert(slot.child.get(), shift + BITS, std::move(leaf));
+				return copy;
+			}
+
+			/**
+			 * 	@brief	Copy the path to a key, without it
+			 *
+			 * 	A node left holding one key is replaced by that key
+			 *
+			 * 	@param	const HashNode*		Node the path starts at
+			 * 	@param	size_type		Bits of the hash used above the node
+			 * 	@param	const JSONKey&		The key, which must be in the trie
+			 * 	@param	size_type		Hash of the key
+			 * 	@return	std::shared_ptr<const HashNode>		The copy of the node, nullptr if it is left empty
+			 */
+			static std::shared_ptr<const HashNode> remove(const HashNode* node, size_type shift,
+					const JSONKey& key, size_type hash) {
+				auto copy = std::make_shared<HashNode>(*node);
+				if(shift >= HASH_BITS) {
+					for(auto slot = copy->slots.begin(); slot != copy->slots.end(); ++slot) {
+						if(slot->key == key) {
+							copy->slots.erase(slot);
+							break;
+						}
+					}
+					return copy->slots.empty() ? nullptr : copy;
+				}
+
+				const uint32_t bit = JSONPersistentMap::hashBit(hash, shift);
+				const size_type index = JSONPersistentMap::slotIndex(copy->bitmap, bit);
+				HashSlot& slot = copy->slots[index];
+				std::shared_ptr<const HashNode> child;
+				if(slot.child)
+					child = JSONPersistentMap::remove(slot.child.get(), shift + BITS, key, hash);
+
+				if(child && child->slots.size() == 1 && !child->slots.front().child)
+					slot = child->slots.front();
+				else if(child)
+					slot.child = std::move(child);
+				else {
+					copy->slots.erase(copy->slots.begin() + index);
+					copy->bitmap &= ~bit;
+				}
+				return copy->slots.empty() ? nullptr : copy;
+			}
+
+			/**
+			 * 	@brief	Build the node for keys that share the hash bits above a level
+			 *
+			 * 	The keys are spread over the node's slots by the next 5 bits of their
+			 * 	hash, in order, and the slots holding several are built the same way
+			 *
+			 * 	@param	std::vector<HashSlot>&		The keys, first to last are built into the node
+			 * 	@param	size_type		First key
+			 * 	@param	size_type		One past the last key
+			 * 	@param	size_type		Bits of the hash used above the node
+			 * 	@param	std::vector<bool>&		Set for the position of every later duplicate of a key
+			 * 	@return	std::shared_ptr<const HashNode>		The node
+			 */
+			static std::shared_ptr<const HashNode> build(std::vector<HashSlot>& leaves, size_type first,
+					size_type last, size_type shift, std::vector<bool>& duplicates) {
+				auto node = std::make_shared<HashNode>();
+				if(shift >= HASH_BITS) {
+					for(size_type i = first; i < last; ++i) {
+						bool seen = false;
+						for(const HashSlot& slot : node->slots)
+							seen = seen || slot.key == leaves[i].key;
+						if(seen)
+							duplicates[leaves[i].position] = true;
+						else
+							node->slots.push_back(std::move(leaves[i]));
+					}
+					return node;
+				}
+
+				// Sort the keys by their next bits, keeping their order within each slot
+				size_type starts[33] = {};
+				for(size_type i = first; i < last; ++i)
+					++starts[((leaves[i].hash >> shift) & 31) + 1];
+				for(size_type bucket = 0; bucket < 32; ++bucket)
+					starts[bucket + 1] += starts[bucket];
+
+				std::vector<HashSlot> sorted(last - first);
+				size_type next[32];
+				std::copy(starts, starts + 32, next);
+				for(size_type i = first; i < last; ++i)
+					sorted[next[(leaves[i].hash >> shift) & 31]++] = std::move(leaves[i]);
+				std::move(sorted.begin(), sorted.end(), leaves.begin() + first);
+
+				for(size_type bucket = 0; bucket < 32; ++bucket) {
+					const size_type size = starts[bucket + 1] - starts[bucket];
+					if(size == 0)
+						continue;
+
+					node->bitmap |= uint32_t(1) << bucket;
+					if(size == 1)
+						node->slots.push_back(std::move(leaves[first + starts[bucket]]));
+					else {
+						node->slots.push_back(HashSlot{JSONPersistentMap::build(leaves, first + starts[bucket],
+								first + starts[bucket + 1], shift + BITS, duplicates), JSONKey(), 0, 0});
+					}
+				}
+				return node;
+			}
+	};
+}
+#endif
@@ -0,0 +1,170 @@
+/**
+ *  @file		json_reusable_parser.h
+ *  @brief	  A parser object that keeps its buffers from one document to the next
+ *
+ * 	JSONTextParser and JSONParser are static, so every call builds its scratch
+ * 	buffers, containers and streams from nothing.  A JSONReusableParser is made
+ * 	once, normally one per thread, and kept: the event parser's token stack,
+ * 	the tape, the arena's pools, the interned keys and the output buffer all
+ * 	keep the room they have grown to, so once they fit the largest document
+ * 	seen, parsing and writing stop allocating
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_REUSABLE_PARSER_H
+#define JSON_REUSABLE_PARSER_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+
+#include "json_arena_document.h"
+#include "json_event_parser.h"
+#include "json_key.h"
+#include "json_serializer.h"
+#include "json_tape.h"
+#include "jsonable.h"
+
+namespace json {
+	/**
+	 * 	@class		JSONReusableParser
+	 * 	@brief		Parse and write many documents with the same buffers
+	 *
+	 * 	-parseTape: text -> the parser's tape, no allocations once the tape is large enough
+	 * 	-parseArena: text -> a value in the parser's pools, built in the last document's memory
+	 * 	-parse: text -> JSON, keys interned in the parser's pool
+	 * 	-write: JSON -> text in the parser's output buffer
+	 * 	A result is only valid until the next call of the same kind.  A parser is
+	 * 	not thread safe, each thread should have its own.
+	 *
+	 */
+	class JSONReusableParser {
+		public:
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			JSONReusableParser();
+
+			/// Copying is not allowed, the event parsers refer to the parser's own builders
+			JSONReusableParser(const JSONReusableParser& copy) = delete;
+
+			/**
+			 * 	@brief	Parse text onto the parser's tape
+			 *
+			 * 	The builder and the tape trade buffers each parse, so both end up
+			 * 	large enough and neither allocates again
+			 *
+			 * 	@param	std::string_view		The json text, not needed after the call
+			 * 	@return	const JSONTape&		The tape, valid until the next parseTape
+			 * 	@throw	  JSONException		  If the text is not valid json
+			 *
+			 * 	@version 0.1
+			 */
+			const JSONTape& parseTape(std::string_view jsonText);
+
+			/**
+			 * 	@brief	Parse text into a value allocated from the parser's pools
+			 *
+			 * 	The last value is destroyed first, so its memory goes back to the
+			 * 	pools and the new value is built in it
+			 *
+			 * 	@param	std::string_view		The json text, not needed after the call
+			 * 	@return	const JSONArenaValue&		The value, valid until the next parseArena
+			 * 	@throw	  JSONException		  If the text is not valid json
+			 *
+			 * 	@version 0.1
+			 */
+			const JSONArenaValue& parseArena(std::string_view jsonText);
+
+			/**
+			 * 	@brief	Parse text into a JSON, interning keys in the parser's pool
+			 *
+			 * 	Documents with the same long keys share one copy of each key.  The
+			 * 	pool is emptied before a parse once it holds MAX_POOLED_KEYS keys, so
+			 * 	texts whose keys never repeat do not grow it without bound.  Only the
+			 * 	keys are reused, the JSON returned is a new tree every call
+			 *
+			 * 	@param	std::string_view		The json text
+			 * 	@return	JSON		The object the text held, owned by the caller
+			 * 	@throw	  JSONException		  If the text is not valid json
+			 *
+			 * 	@version 0.1
+			 */
+			JSON parse(std::string_view jsonText);
+
+			/**
+			 * 	@brief	Write a JSON into the parser's output buffer
+			 *
+			 * 	@param	const JSON&		The object to write
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@return	std::string_view		The text, valid until the next write
+			 *
+			 * 	@version 0.1
+			 */
+			std::string_view write(const JSON& j, bool compact = false);
+
+			/**
+			 * 	@brief	Free everything the parser kept, as if it was just built
+			 *
+			 * 	Results of earlier calls are no longer valid
+			 *
+			 * 	@version 0.1
+			 */
+			void clear();
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONReusableParser();
+
+		protected:
+			/// Number of long keys the pool may hold before parse empties it, room for the
+			/// keys of many kinds of documents and small next to the documents themselves
+			static constexpr std::size_t MAX_POOLED_KEYS = 64 * 1024;
+
+			// ----- Tape -----
+			/// Writes each document, then trades buffers with tape
+			JSONTapeBuilder tapeBuilder;
+
+			/// Reads the text into tapeBuilder
+			JSONEventParser tapeParser;
+
+			/// The last document parsed onto a tape
+			JSONTape tape;
+
+			// ----- Arena -----
+			/// Holds the freed memory of earlier values for the next one
+			std::pmr::unsynchronized_pool_resource pools;
+
+			/// Builds each value from pools
+			JSONArenaBuilder arenaBuilder;
+
+			/// Reads the text into arenaBuilder
+			JSONEventParser arenaParser;
+
+			/// The last value parsed into the pools
+			JSONArenaValue arenaRoot;
+
+			// ----- JSON -----
+			/// Long keys seen so far
+			JSONKeyPool keys;
+
+			/// Writes pretty text, keeping its buffer
+			JSONSerializer prettyWriter;
+
+			/// Writes compact text, keeping its buffer
+			JSONSerializer compactWriter;
+	};
+}
+#endif
@@ -0,0 +1,134 @@
+/**
+ *  @file		json_string.h
+ *  @brief	  Escape and unescape the contents of json strings with SIMD kernels
+ *
+ * 	Writing scans 16 or 32 bytes at a time for the characters RFC 8259 says
+ * 	must be escaped (the quote, the backslash and control characters below
+ * 	0x20), and reading scans for the closing quote or a backslash the same
+ * 	way.  The runs between those characters are copied in whole, so strings
+ * 	with nothing to escape cost one scan and one copy.  The kernel is picked
+ * 	at runtime like JSONStructuralIndex's.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_STRING_H
+#define JSON_STRING_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "json_structural_index.h"
+
+namespace json {
+	/**
+	 * 	@class		JSONString
+	 * 	@brief		Convert between the text of a json string and its characters
+	 *
+	 * 	-Escaping writes \" \\ \b \f \n \r \t, and \u00XX for the other control
+	 * 	characters, everything else is copied as it is
+	 * 	-Unescaping also reads \/ and \', and \uXXXX escapes (joining surrogate
+	 * 	pairs) as UTF-8
+	 *
+	 */
+	class JSONString {
+		public:
+			/**
+			 * 	@brief	Find the first character that has to be escaped
+			 *
+			 * 	@param	const char*		Start of the characters
+			 * 	@param	const char*		End of the characters
+			 * 	@return	const char*		The character, or end if there is none
+			 *
+			 * 	@version 0.1
+			 */
+			static const char* findEscapable(const char* p, const char* end);
+
+			/**
+			 * 	@brief	Find the quote that closes a string, stepping over escapes
+			 *
+			 * 	@param	const char*		First character after the opening quote
+			 * 	@param	const char*		End of the text
+			 * 	@param	char		The quote that opened the string, ' or "
+			 * 	@param	bool		If the first character is escaped, because the backslash
+			 * 	before it was in an earlier piece of the text
+			 * 	@return	const char*		The closing quote, or nullptr if the text ends first
+			 *
+			 * 	@version 0.1
+			 */
+			static const char* findClose(const char* p, const char* end, char quote, bool escaped = false);
+
+			/// If a string has characters that have to be escaped
+			static bool needsEscaping(std::string_view s) {
+				return JSONString::findEscapable(s.data(), s.data() + s.size()) != s.data() + s.size();
+			}
+
+			/**
+			 * 	@brief	Append the escaped text of a string, without quotes
+			 *
+			 * 	@param	std::string_view		The characters
+			 * 	@param	std::string&		Where to append
+			 *
+			 * 	@version 0.1
+			 */
+			static void appendEscaped(std::string_view s, std::string& out);
+
+			/**
+			 * 	@brief	Append the characters of a string's text
+			 *
+			 * 	@param	std::string_view		The text between the quotes
+			 * 	@param	std::string&		Where to append
+			 * 	@throw	  JSONException		  If an escape is not valid
+			 *
+			 * 	@version 0.1
+			 */
+			static void appendUnescaped(std::string_view text, std::string& out);
+
+			/**
+			 * 	@brief	Get the characters of a string's text
+			 *
+			 * 	Text without a backslash is its own characters, and is returned
+			 * 	without a copy
+			 *
+			 * 	@param	std::string_view		The text between the quotes
+			 * 	@param	std::string&		Holds the characters if they differ from the text
+			 * 	@return	std::string_view		The characters, in text or scratch
+			 * 	@throw	  JSONException		  If an escape is not valid
+			 *
+			 * 	@version 0.1
+			 */
+			static std::string_view unescaped(std::string_view text, std::string& scratch);
+
+			/// Get the characters of a string's text as a new string
+			static std::string unescape(std::string_view text) {
+				std::string s;
+				JSONString::appendUnescaped(text, s);
+				return s;
+			}
+
+			/// Get the escaped text of a string as a new string, without quotes
+			static std::string escape(std::string_view s) {
+				std::string text;
+				JSONString::appendEscaped(s, text);
+				return text;
+			}
+
+		protected:
+			/**
+			 * 	@brief	Scan with a chosen kernel from now on, in place of the fastest one
+			 *
+			 * 	Every kernel finds the same characters, so this is for comparing
+			 * 	them.  It is not thread safe, nothing may be scanning while it is
+			 * 	called.  A kernel the cpu does not support is replaced by SCALAR
+			 *
+			 * 	@param	JSONStructuralIndex::Kernel		The kernel
+			 *
+			 * 	@version 0.1
+			 */
+			static void useKernel(JSONStructuralIndex::Kernel kernel);
+	};
+}
+#endif
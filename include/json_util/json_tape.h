@@ -0,0 +1,496 @@
+/**
+ *  @file		json_tape.h
+ *  @brief	  A json document flattened into one array of 64 bit words
+ *
+ * 	Every value is written to the tape in the order it appears in the text.
+ * 	The top 8 bits of a word are its type, the other 56 its payload:
+ * 	-'{' '[' hold the position of their closing word in the low 32 bits and
+ * 	the number of members or elements (saturated) in the next 24
+ * 	-'}' ']' hold the position of their opening word
+ * 	-'"' holds the offset of the string in the string buffer, where its
+ * 	characters follow a 32 bit length.  Keys are strings before their value
+ * 	-'l' 'u' 'd' (int64_t, uint64_t, double) are followed by a word with the value
+ * 	-'t' 'f' 'n' are true, false and null
+ * 	A parse fills the tape and the string buffer and nothing else, and walking
+ * 	it reads memory in order
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_TAPE_H
+#define JSON_TAPE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "json_event_handler.h"
+#include "json_exception.h"
+#include "jsonable.h"
+
+namespace json {
+	class JSONTape;
+	class JSONTapeObject;
+	class JSONTapeArray;
+
+	/**
+	 * 	@class		JSONTapeValue
+	 * 	@brief		A view of one value on a JSONTape
+	 *
+	 * 	-Two words wide, copied by value, valid while the tape is
+	 * 	-Getters throw a JSONException if the value is not of the type asked for
+	 *
+	 */
+	class JSONTapeValue {
+		public:
+			/// Default Constructor, refers to no tape
+			JSONTapeValue() :
+				tape(nullptr),
+				index(0) { }
+
+			/// Initializing Constructor, the value starting at a word of the tape
+			JSONTapeValue(const JSONTape* tape, std::size_t index) :
+				tape(tape),
+				index(index) { }
+
+			/// The type character of the value, see the file comment
+			char getType() const;
+
+			// ----- Type checks -----
+			bool isNull() const { return this->getType() == 'n'; }
+			bool isBool() const { return this->getType() == 't' || this->getType() == 'f'; }
+			bool isInteger() const { return this->getType() == 'l' || this->getType() == 'u'; }
+			bool isNumber() const { return this->isInteger() || this->getType() == 'd'; }
+			bool isString() const { return this->getType() == '"'; }
+			bool isObject() const { return this->getType() == '{'; }
+			bool isArray() const { return this->getType() == '['; }
+
+			// ----- Getters -----
+			bool getBool() const;
+
+			/// Integer value, throws if it does not fit in an int64_t
+			int64_t getInt64() const;
+
+			/// Integer value, throws if it is negative
+			uint64_t getUint64() const;
+
+			/// Any number, as a double
+			double getDouble() const;
+
+			/// The characters of a string, valid while the tape is
+			std::string_view getString() const;
+
+			/// The members of an object, in order
+			JSONTapeObject getObject() const;
+
+			/// The elements of an array, in order
+			JSONTapeArray getArray() const;
+
+			/**
+			 * 	@brief	Get the number of members of an object or elements of an array
+			 *
+			 * 	@return	std::size_t		The count, stored on the tape unless it is very large
+			 * 	@throw	  JSONException		If the value is not an object or array
+			 *
+			 * 	@version 0.1
+			 */
+			std::size_t size() const;
+
+			/**
+			 * 	@brief	Get the member of an object with the key
+			 *
+			 * 	@param	std::string_view		The key
+			 * 	@return	JSONTapeValue		The value of the first member with the key
+			 * 	@throw	  JSONException		If there is no such member
+			 *
+			 * 	@version 0.1
+			 */
+			JSONTapeValue operator[](std::string_view key) const;
+
+			/**
+			 * 	@brief	Get an element of an array
+			 *
+			 * 	@param	std::size_t		The position of the element
+			 * 	@return	JSONTapeValue		The element, found by skipping the ones before it
+			 * 	@throw	  JSONException		If there is no such element
+			 *
+			 * 	@version 0.1
+			 */
+			JSONTapeValue operator[](std::size_t position) const;
+
+			/// The word after this value, where the next value starts
+			std::size_t getNext() const;
+
+			/// The word this value starts at
+			std::size_t getIndex() const {
+				return this->index;
+			}
+
+			/**
+			 * 	@brief	Build the JSONValue form of the value
+			 *
+			 * 	@return	JSONValue		The same value
+			 *
+			 * 	@version 0.1
+			 */
+			JSONValue toJSONValue() const;
+
+		protected:
+			/// The tape the value is on
+			const JSONTape* tape;
+
+			/// The word the value starts at
+			std::size_t index;
+
+			/// Throw unless the value is of the type
+			void expectType(char type, const char* name) const;
+	};
+
+	/// A member of an object on a tape
+	struct JSONTapeMember {
+		std::string_view first;
+		JSONTapeValue second;
+	};
+
+	/**
+	 * 	@class		JSONTapeObject
+	 * 	@brief		The members of an object on a tape, as a forward range
+	 *
+	 */
+	class JSONTapeObject {
+		public:
+			/**
+			 * 	@class		const_iterator
+			 * 	@brief		Steps from member to member, skipping over their values
+			 *
+			 */
+			class const_iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = JSONTapeMember;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const JSONTapeMember*;
+					using reference = const JSONTapeMember&;
+
+					/// Initializing Constructor, the member whose key is at a word
+					const_iterator(const JSONTape* tape, std::size_t index);
+
+					reference operator*() const { return this->member; }
+					pointer operator->() const { return &this->member; }
+
+					/// Move to the next member
+					const_iterator& operator++();
+
+					bool operator==(const const_iterator& other) const { return this->index == other.index; }
+					bool operator!=(const const_iterator& other) const { return this->index != other.index; }
+
+				protected:
+					/// The tape of the object
+					const JSONTape* tape;
+
+					/// The word of the current key
+					std::size_t index;
+
+					/// The current key and value
+					JSONTapeMember member;
+			};
+
+			/// Initializing Constructor, the object starting at a word
+			JSONTapeObject(const JSONTape* tape, std::size_t index) :
+				tape(tape),
+				index(index) { }
+
+			const_iterator begin() const;
+			const_iterator end() const;
+
+		protected:
+			/// The tape of the object
+			const JSONTape* tape;
+
+			/// The word of the '{'
+			std::size_t index;
+	};
+
+	/**
+	 * 	@class		JSONTapeArray
+	 * 	@brief		The elements of an array on a tape, as a forward range
+	 *
+	 */
+	class JSONTapeArray {
+		public:
+			/**
+			 * 	@class		const_iterator
+			 * 	@brief		Steps from element to element, skipping over their contents
+			 *
+			 */
+			class const_iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = JSONTapeValue;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const JSONTapeValue*;
+					using reference = const JSONTapeValue&;
+
+					/// Initializing Constructor, the element starting at a word
+					const_iterator(const JSONTape* tape, std::size_t index) :
+						tape(tape),
+						element(tape, index) { }
+
+					reference operator*() const { return this->element; }
+					pointer operator->() const { return &this->element; }
+
+					/// Move to the next element
+					const_iterator& operator++() {
+						this->element = JSONTapeValue(this->tape, this->element.getNext());
+						return *this;
+					}
+
+					bool operator==(const const_iterator& other) const {
+						return this->element.getIndex() == other.element.getIndex();
+					}
+					bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+				protected:
+					/// The tape of the array
+					const JSONTape* tape;
+
+					/// The current element
+					JSONTapeValue element;
+			};
+
+			/// Initializing Constructor, the array starting at a word
+			JSONTapeArray(const JSONTape* tape, std::size_t index) :
+				tape(tape),
+				index(index) { }
+
+			const_iterator begin() const;
+			const_iterator end() const;
+
+		protected:
+			/// The tape of the array
+			const JSONTape* tape;
+
+			/// The word of the '['
+			std::size_t index;
+	};
+
+	/**
+	 * 	@class		JSONTape
+	 * 	@brief		The words and strings of a parsed document
+	 *
+	 * 	Move only, views into the tape hold its address.
+	 *
+	 */
+	class JSONTape {
+		public:
+			/// Containers with more members than this keep this as their count
+			static constexpr uint64_t MAX_COUNT = 0xFFFFFF;
+
+			/// Default Constructor, an empty tape
+			JSONTape();
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	@param	std::vector<uint64_t>&&		The words, see the file comment
+			 * 	@param	std::string&&		The string buffer
+			 *
+			 * 	@version	0.1
+			 */
+			JSONTape(std::vector<uint64_t>&& words, std::string&& strings);
+
+			/// Copying is not allowed, values on the tape point to it
+			JSONTape(const JSONTape& copy) = delete;
+
+			/// Move Constructor
+			JSONTape(JSONTape&& other) = default;
+
+			/// Move assignment
+			JSONTape& operator=(JSONTape&& other) = default;
+
+			/// Get the outermost value
+			JSONTapeValue getRoot() const {
+				return JSONTapeValue(this, 0);
+			}
+
+			/// Get the words of the tape
+			const std::vector<uint64_t>& getWords() const {
+				return this->words;
+			}
+
+			/// Get the string buffer
+			const std::string& getStrings() const {
+				return this->strings;
+			}
+
+			/// Get the type character of a word
+			char getType(std::size_t index) const {
+				return static_cast<char>(this->words[index] >> 56);
+			}
+
+			/// Get the payload of a word
+			uint64_t getPayload(std::size_t index) const {
+				return this->words[index] & JSONTape::PAYLOAD_MASK;
+			}
+
+			/// Get the string stored at an offset of the string buffer
+			std::string_view getString(std::size_t offset) const;
+
+			/**
+			 * 	@brief	Exchange the words and strings of the tape with other buffers
+			 *
+			 * 	Lets a JSONTapeBuilder hand over a finished tape and take the old
+			 * 	buffers back to write the next one into
+			 *
+			 * 	@param	std::vector<uint64_t>&		Words to swap with
+			 * 	@param	std::string&		String buffer to swap with
+			 */
+			void swap(std::vector<uint64_t>& words, std::string& strings) {
+				this->words.swap(words);
+				this->strings.swap(strings);
+			}
+
+			/// Build a word from its type and payload
+			static uint64_t makeWord(char type, uint64_t payload) {
+				return (static_cast<uint64_t>(static_cast<unsigned char>(type)) << 56) | payload;
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONTape();
+
+		protected:
+			/// The low 56 bits of a word
+			static constexpr uint64_t PAYLOAD_MASK = (uint64_t(1) << 56) - 1;
+
+			/// One or two words for each value
+			std::vector<uint64_t> words;
+
+			/// Characters of every string and key, each after its 32 bit length
+			std::string strings;
+	};
+
+	/**
+	 * 	@class		JSONTapeBuilder
+	 * 	@brief		A JSONEventHandler that writes the events onto a tape
+	 *
+	 */
+	class JSONTapeBuilder : public JSONEventHandler {
+		public:
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Reserve room for the document, so a typical text fills the tape and
+			 * 	string buffer without either growing
+			 *
+			 * 	@param	std::size_t		Length of the json text, 0 if unknown
+			 *
+			 * 	@version	0.1
+			 */
+			JSONTapeBuilder(std::size_t textLength = 0);
+
+			// ----- Events, each one writes to the tape -----
+			virtual void onStartObject() override;
+			virtual void onKey(std::string_view key) override;
+			virtual void onEndObject() override;
+			virtual void onStartArray() override;
+			virtual void onEndArray() override;
+			virtual void onInt(int value) override;
+			virtual void onInt64(int64_t value) override;
+			virtual void onUint64(uint64_t value) override;
+			virtual void onDouble(double value) override;
+			virtual void onString(std::string_view value) override;
+			virtual void onBool(bool value) override;
+			virtual void onNull() override;
+
+			/**
+			 * 	@brief	Check if a whole value has been written
+			 *
+			 * 	@return	bool		If the outermost value has been finished
+			 */
+			bool isComplete() const {
+				return this->complete;
+			}
+
+			/**
+			 * 	@brief	Take the tape written, and start over
+			 *
+			 * 	@return	JSONTape		The tape
+			 *
+			 * 	@version 0.1
+			 */
+			JSONTape takeTape();
+
+			/**
+			 * 	@brief	Put the tape written into a JSONTape, and start over in the tape's old buffers
+			 *
+			 * 	Neither tape allocates once both buffers are large enough, so a builder
+			 * 	and a tape that are kept can write any number of documents
+			 *
+			 * 	@param	JSONTape&		Tape to put the words and strings into
+			 *
+			 * 	@version 0.1
+			 */
+			void swapTape(JSONTape& tape);
+
+			/**
+			 * 	@brief	Drop anything written so far, keeping the room the buffers have grown to
+			 *
+			 * 	@version 0.1
+			 */
+			void reset();
+
+			/**
+			 * 	@brief	Drop anything written so far and free the buffers
+			 *
+			 * 	@version 0.1
+			 */
+			void release();
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			virtual ~JSONTapeBuilder();
+
+		protected:
+			/// The words written so far
+			std::vector<uint64_t> words;
+
+			/// The strings written so far
+			std::string strings;
+
+			/// Position of the opening word and member count of each open container, innermost last
+			std::vector<std::pair<std::size_t, uint64_t>> open;
+
+			/// If the outermost value has been finished
+			bool complete;
+
+			/// Count a value in the innermost container, or finish the document
+			void added();
+
+			/// Write the opening word of a container
+			void start(char type);
+
+			/// Write the closing word of a container and go back to fill in its opening word
+			void end(char type);
+
+			/// Write a string to the buffer and its word to the tape
+			void writeString(std::string_view value);
+	};
+}
+#endif
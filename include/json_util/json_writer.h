@@ -0,0 +1,256 @@
+/**
+ *  @file		json_writer.h
+ *  @brief	  Write json text one member and element at a time, with no document built first
+ *
+ * 	A JSONWriter is told the shape of the text as it goes (beginObject,
+ * 	key, value, endObject, ...) and appends it to the same buffer a
+ * 	JSONSerializer uses, handing it to a sink as it fills.  A JSONAble that
+ * 	overrides writeJSON is written straight from its members, so an object
+ * 	graph of any size is written in the memory of the buffer.
+ *
+ * 	Builds without NDEBUG check that the calls nest: keys only in objects,
+ * 	values after keys, each end closing what was begun, and only one value
+ * 	at the top level until clear
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "json_serializer.h"
+#include "jsonable.h"
+
+namespace json {
+	/**
+	 * 	@class		JSONDescriptorSink
+	 * 	@brief		A JSONSink that writes to a file descriptor
+	 *
+	 */
+	class JSONDescriptorSink : public JSONSink {
+		public:
+			/// Initializing Constructor, the descriptor stays open and owned by the caller
+			JSONDescriptorSink(int fd) : fd(fd) { }
+
+			/**
+			 * 	@brief	Write all of the text to the descriptor
+			 *
+			 * 	@param	const char*		Start of the text
+			 * 	@param	std::size_t		Number of characters
+			 * 	@throw	  JSONException		  If the descriptor can not be written
+			 *
+			 * 	@version 0.1
+			 */
+			virtual void write(const char* data, std::size_t length) override;
+
+			/**
+			 * 	@brief	Write all of the pieces to the descriptor, gathered by writev
+			 *
+			 * 	@param	const std::string_view*		The pieces
+			 * 	@param	std::size_t		Number of pieces
+			 * 	@throw	  JSONException		  If the descriptor can not be written
+			 *
+			 * 	@version 0.1
+			 */
+			virtual void writePieces(const std::string_view* pieces, std::size_t count) override;
+
+		protected:
+			/// The descriptor written to
+			int fd;
+
+			/**
+			 * 	@brief	Gather one batch of pieces into the descriptor, the one call to writev
+			 *
+			 * 	Like writev, it may write only part of the pieces, and returns -1
+			 * 	with errno set on an error
+			 *
+			 * 	@param	const iovec*		The pieces
+			 * 	@param	int		Number of pieces, at most IOV_MAX
+			 * 	@return	ssize_t		Number of characters written, or -1
+			 *
+			 * 	@version 0.1
+			 */
+			virtual ssize_t writeVectors(const iovec* vectors, int count);
+	};
+
+	/**
+	 * 	@class		JSONWriter
+	 * 	@brief		Write json text as a sequence of calls
+	 *
+	 * 	-beginObject / endObject and beginArray / endArray wrap containers
+	 * 	-key names the next member of an object, value writes a whole value
+	 * 	-member is a key and its value
+	 * 	The layout is the same as JSONSerializer's, compact or pretty.  Without a
+	 * 	sink the text stays in the buffer, with one flush must be called after
+	 * 	the last value.
+	 *
+	 */
+	class JSONWriter : protected JSONSerializer {
+		public:
+			using JSONSerializer::getText;
+			using JSONSerializer::takeText;
+			using JSONSerializer::flush;
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	Text stays in the buffer until it is taken
+			 *
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@param	std::string		Indentation of one level in pretty text
+			 *
+			 * 	@version	0.1
+			 */
+			JSONWriter(bool compact = false, std::string indent = "\t");
+
+			/**
+			 * 	@brief	Initializing Constructor
+			 *
+			 * 	@param	JSONSink&		The sink, which must outlive the writer
+			 * 	@param	bool		If the text should have no whitespace
+			 * 	@param	std::string		Indentation of one level in pretty text
+			 *
+			 * 	@version	0.1
+			 */
+			JSONWriter(JSONSink& sink, bool compact = false, std::string indent = "\t");
+
+			/// Open an object
+			JSONWriter& beginObject();
+
+			/// Close the innermost object
+			JSONWriter& endObject();
+
+			/// Open an array
+			JSONWriter& beginArray();
+
+			/// Close the innermost array
+			JSONWriter& endArray();
+
+			/**
+			 * 	@brief	Name the next member of the innermost object
+			 *
+			 * 	@param	std::string_view		The key
+			 * 	@return	JSONWriter&		The writer
+			 * 	@throw	  JSONException		  Without NDEBUG, if not in an object or the
+			 * 	last key has no value
+			 *
+			 * 	@version 0.1
+			 */
+			JSONWriter& key(std::string_view name);
+
+			/// Write null
+			JSONWriter& null();
+
+			/// Write a bool
+			JSONWriter& value(bool item);
+
+			/// Write an integer
+			JSONWriter& value(int item);
+
+			/// Write a 64 bit integer
+			JSONWriter& value(int64_t item);
+
+			/// Write an unsigned 64 bit integer
+			JSONWriter& value(uint64_t item);
+
+			/// Write a double in the fewest digits that read back the same, throw a JSONException for NaN or infinity
+			JSONWriter& value(double item);
+
+			/// Write a string
+			JSONWriter& value(std::string_view item);
+
+			/// Write a string
+			JSONWriter& value(const std::string& item) {
+				return this->value(std::string_view(item));
+			}
+
+			/// Write a string
+			JSONWriter& value(const char* item) {
+				return this->value(std::string_view(item));
+			}
+
+			/// Write any value, with its objects and arrays
+			JSONWriter& value(const JSONValue& item);
+
+			/// Write an object with all of its members
+			JSONWriter& value(const JSON& item);
+
+			/// Write an array with all of its elements
+			JSONWriter& value(const JSONArray& item);
+
+			/**
+			 * 	@brief	Write an object through its writeJSON hook
+			 *
+			 * 	@param	const JSONAble&		The object
+			 * 	@return	JSONWriter&		The writer
+			 *
+			 * 	@version 0.1
+			 */
+			JSONWriter& value(const JSONAble& item);
+
+			/// Write a member of the innermost object
+			template <typename T>
+			JSONWriter& member(std::string_view name, const T& item) {
+				this->key(name);
+				return this->value(item);
+			}
+
+			/// Number of containers open
+			std::size_t getDepth() const {
+				return this->containers.size();
+			}
+
+			/// Empty the buffer and close every container, keeping the buffer's room, to write a new text
+			void clear() {
+				JSONSerializer::clear();
+				this->containers.clear();
+				this->first = true;
+				this->afterKey = false;
+			}
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Details
+			 *
+			 * 	@version	0.1
+			 */
+			~JSONWriter();
+
+		protected:
+			/// The open containers, '{' or '[', innermost last
+			std::vector<char> containers;
+
+			/// If the innermost container has nothing in it yet, or with none open, if nothing was written
+			bool first;
+
+			/// If a key was written and its value has not been
+			bool afterKey;
+
+			/// Write what comes before a value, the separator and line break in an array
+			void beginValue();
+
+			/// Write the separator and line break before a member or an element
+			void separate();
+
+			/// Close the innermost container, which is opened by open
+			void end(char open, char close);
+
+			/// Hand the buffer to the sink if it has filled, once a value is finished
+			void endValue() {
+				this->flushIfFull();
+			}
+	};
+}
+#endif
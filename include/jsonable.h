@@ -6,28 +6,39 @@
  *
  *  @author		Gabriel Shelton	sheltongabe
  *  @date		  08-02-2018
- *  @version	0.4
+ *  @version	0.6
  */
 
 #ifndef JSONABLE_H
 #define JSONABLE_H
 
+#include <cstdint>
 #include <map>
+#include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include "json_flat_map.h"
+
 namespace json {
 	// Forward declare a class for arrays and objects
 	class JSONObject;
 	class JSONArray;
 
+	// Forward declare the writer JSONAble objects can stream themselves to
+	class JSONWriter;
+
 	/// Defines JSONValues to be a variant
-	//	<int, double, string, bool, std::monostate (null), JSONObject>
+	//	<int, double, string, bool, std::monostate (null), JSONObject, JSONArray,
+	//	int64_t, uint64_t>, the 64 bit integers hold what does not fit in an int
 	using JSONValue = std::variant<
-			int, double, std::string, bool, std::monostate, JSONObject, JSONArray>;
+			int, double, std::string, bool, std::monostate, JSONObject, JSONArray,
+			int64_t, uint64_t>;
 
-	/// Define JSON to be a map between string keys and JSONValues
-	using JSON = std::map<std::string, JSONValue>;
+	/// Define JSON to be a map between string keys and JSONValues, kept in the order
+	//	the members were added
+	using JSON = JSONFlatMap<JSONValue>;
 
 	/**
 	 * 	@class		JSONAble
@@ -84,6 +95,18 @@ namespace json {
 			 */
 			virtual JSON getJSON() const = 0;
 
+			/**
+			 * @brief	write the object straight to a JSONWriter
+			 * 
+			 * 	Override to write the members as they are, with no JSON map built
+			 * 	first, as exactly one value.  By default the map from getJSON is written.
+			 * 
+			 * 	@param	JSONWriter&		The writer
+			 * 
+			 * 	@version 0.1
+			 */
+			virtual void writeJSON(JSONWriter& writer) const;
+
 			/**
 			 * 	@brief	Destructor
 			 *
@@ -103,17 +126,17 @@ namespace json {
 	 * 	Uses JSON as the definition of the JSONObject, but it has to be done like this
 	 * 	because, when JSONValues is defined the compiler is not yet aware of JSON
 	 * 
-	 * 	@version 0.3
+	 * 	@version 0.4
 	 */
 	class JSONObject : public JSON { 
 		public:
 			/// Default Constructor
 			JSONObject() : JSON() { }
-			/// Copy Constructor for JSON
-			JSONObject(JSON& j) : JSON(j) { }
+			/// Copy Constructor for JSON, copies every member
+			JSONObject(const JSON& j) : JSON(j) { }
 
-			/// Move Constructor for JSON
-			JSONObject(JSON&& j) : JSON(j) { }
+			/// Move Constructor for JSON, takes the members without copying them
+			JSONObject(JSON&& j) : JSON(std::move(j)) { }
 
 			/// overload operator for ==
 			bool operator==(const JSONObject& object) {
@@ -132,18 +155,18 @@ namespace json {
 	 * 
 	 * 
 	 * 
-	 * 	@version 0.4
+	 * 	@version 0.5
 	 */
 	class JSONArray : public std::vector<JSONValue> {
 		public:
 			/// Default Constructor
 			JSONArray() : std::vector<JSONValue>() { }
 
-			/// Copy constructor using vector
-			JSONArray(std::vector<JSONValue>& v) : std::vector<JSONValue>(v) { }
+			/// Copy constructor using vector, copies every element
+			JSONArray(const std::vector<JSONValue>& v) : std::vector<JSONValue>(v) { }
 
-			/// Move constructor using vector
-			JSONArray(std::vector<JSONValue>&& v) : std::vector<JSONValue>(v) { }
+			/// Move constructor using vector, takes the elements without copying them
+			JSONArray(std::vector<JSONValue>&& v) : std::vector<JSONValue>(std::move(v)) { }
 
 			/// overload operator for ==
 			bool operator==(const JSONArray& array) {
@@ -0,0 +1,90 @@
+/**
+ *  @file		json_arena_document.cpp
+ *  @brief	  Build json values in an arena and copy them back out
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+#include "json_arena_document.h"
+#include "json_event_parser.h"
+
+namespace json {
+	// The builder of arena values is instantiated here, once for the library
+	template class JSONBasicBuilder<JSONArenaTraits>;
+
+	//
+	// Initializing Constructor
+	//
+	JSONArenaDocument::JSONArenaDocument(std::string_view jsonText,
+			std::pmr::memory_resource* upstream) :
+			arena(std::max<std::size_t>(jsonText.size(), 1024), upstream),
+			root(nullptr) {
+		// Build the values in the arena from the parser's events
+		JSONArenaBuilder builder(&this->arena);
+		JSONEventParser parser(builder);
+		parser.feed(jsonText);
+		parser.finish();
+
+		// The root lives in the arena as well, so nothing has to be destroyed
+		void* storage = this->arena.allocate(sizeof(JSONArenaValue), alignof(JSONArenaValue));
+		this->root = new(storage) JSONArenaValue(builder.takeValue());
+	}
+
+	//
+	// operator[] (std::string_view) -> const JSONArenaValue&
+	//
+	const JSONArenaValue& JSONArenaDocument::operator[](std::string_view key) const {
+		const JSONArenaObject* object = std::get_if<JSONArenaObject>(this->root);
+		if(object == nullptr)
+			throw JSONException("The root of the json document is not an object");
+
+		auto member = object->find(key);
+		if(member == object->end())
+			throw JSONException("No member with the key: " + std::string(key));
+
+		return member->second;
+	}
+
+	//
+	// toJSONValue (const JSONArenaValue&) -> JSONValue
+	//
+	JSONValue JSONArenaDocument::toJSONValue(const JSONArenaValue& value) {
+		return std::visit([](const auto& v) -> JSONValue {
+			using T = std::decay_t<decltype(v)>;
+
+			if constexpr(std::is_same_v<T, std::pmr::string>)
+				return std::string(v);
+			else if constexpr(std::is_same_v<T, JSONArenaObject>) {
+				JSONObject object;
+				for(const auto& member : v)
+					object.emplace(std::string(member.first), JSONArenaDocument::toJSONValue(member.second));
+				return object;
+			}
+			else if constexpr(std::is_same_v<T, JSONArenaArray>) {
+				JSONArray array;
+				array.reserve(v.size());
+				for(const JSONArenaValue& element : v)
+					array.push_back(JSONArenaDocument::toJSONValue(element));
+				return array;
+			}
+			else
+				return v;
+		}, value);
+	}
+
+	//
+	// Destructor
+	//
+	JSONArenaDocument::~JSONArenaDocument() {
+		// Every allocation of the values came from the arena, which frees its blocks
+		// when it is destroyed, so the values are left as they are
+	}
+}
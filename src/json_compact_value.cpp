@@ -0,0 +1,399 @@
+/**
+ *  @file		json_compact_value.cpp
+ *  @brief	  Implement the 16 byte json value and building it from events
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <limits>
+#include <type_traits>
+
+#include "json_compact_value.h"
+
+namespace json {
+	//
+	// Initializing Constructor (bool)
+	//
+	JSONCompactValue::JSONCompactValue(bool value) :
+			length(0),
+			type(BOOLEAN) {
+		this->store(value);
+	}
+
+	//
+	// Initializing Constructor (int)
+	//
+	JSONCompactValue::JSONCompactValue(int value) :
+			length(0),
+			type(INTEGER) {
+		this->store(static_cast<int64_t>(value));
+	}
+
+	//
+	// Initializing Constructor (int64_t)
+	//
+	JSONCompactValue::JSONCompactValue(int64_t value) :
+			length(0),
+			type(INTEGER_64) {
+		this->store(value);
+	}
+
+	//
+	// Initializing Constructor (uint64_t)
+	//
+	JSONCompactValue::JSONCompactValue(uint64_t value) :
+			length(0),
+			type(UNSIGNED_64) {
+		this->store(value);
+	}
+
+	//
+	// Initializing Constructor (double)
+	//
+	JSONCompactValue::JSONCompactValue(double value) :
+			length(0),
+			type(DOUBLE) {
+		this->store(value);
+	}
+
+	//
+	// Initializing Constructor (std::string_view)
+	//
+	JSONCompactValue::JSONCompactValue(std::string_view value) :
+			length(0),
+			type(SHORT_STRING) {
+		// Short strings live in the payload
+		if(value.size() <= JSONCompactValue::SHORT_STRING_CAPACITY) {
+			std::memcpy(this->payload, value.data(), value.size());
+			this->length = static_cast<uint8_t>(value.size());
+			return;
+		}
+
+		// Longer ones in a block of exactly their size, the payload holds its address and length
+		if(value.size() > std::numeric_limits<uint32_t>::max())
+			throw JSONException("String too long for a JSONCompactValue");
+
+		char* characters = new char[value.size()];
+		std::memcpy(characters, value.data(), value.size());
+		this->store(characters);
+		this->store(static_cast<uint32_t>(value.size()), sizeof(char*));
+		this->type = LONG_STRING;
+	}
+
+	//
+	// Initializing Constructor (JSONCompactObject&&)
+	//
+	JSONCompactValue::JSONCompactValue(JSONCompactObject&& value) :
+			length(0),
+			type(OBJECT) {
+		this->store(new JSONCompactObject(std::move(value)));
+	}
+
+	//
+	// Initializing Constructor (JSONCompactArray&&)
+	//
+	JSONCompactValue::JSONCompactValue(JSONCompactArray&& value) :
+			length(0),
+			type(ARRAY) {
+		this->store(new JSONCompactArray(std::move(value)));
+	}
+
+	//
+	// Copy Constructor
+	//
+	JSONCompactValue::JSONCompactValue(const JSONCompactValue& copy) :
+			length(0),
+			type(NULL_TYPE) {
+		this->copyFrom(copy);
+	}
+
+	//
+	// Move Constructor
+	//
+	JSONCompactValue::JSONCompactValue(JSONCompactValue&& other) noexcept :
+			length(other.length),
+			type(other.type) {
+		std::memcpy(this->payload, other.payload, sizeof(this->payload));
+		other.type = NULL_TYPE;
+	}
+
+	//
+	// operator= (const JSONCompactValue&) -> JSONCompactValue&
+	//
+	JSONCompactValue& JSONCompactValue::operator=(const JSONCompactValue& copy) {
+		if(this != &copy) {
+			// Copy first, so a throw leaves this value as it was
+			JSONCompactValue temporary(copy);
+			*this = std::move(temporary);
+		}
+		return *this;
+	}
+
+	//
+	// operator= (JSONCompactValue&&) -> JSONCompactValue&
+	//
+	JSONCompactValue& JSONCompactValue::operator=(JSONCompactValue&& other) noexcept {
+		if(this != &other) {
+			this->release();
+			std::memcpy(this->payload, other.payload, sizeof(this->payload));
+			this->length = other.length;
+			this->type = other.type;
+			other.type = NULL_TYPE;
+		}
+		return *this;
+	}
+
+	//
+	// getBool () -> bool
+	//
+	bool JSONCompactValue::getBool() const {
+		if(this->type != BOOLEAN)
+			throw JSONException("JSONCompactValue is not a bool");
+		return this->load<bool>();
+	}
+
+	//
+	// getInt64 () -> int64_t
+	//
+	int64_t JSONCompactValue::getInt64() const {
+		if(this->type == INTEGER || this->type == INTEGER_64)
+			return this->load<int64_t>();
+		if(this->type == UNSIGNED_64 &&
+				this->load<uint64_t>() <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+			return static_cast<int64_t>(this->load<uint64_t>());
+
+		throw JSONException("JSONCompactValue is not an integer that fits in an int64_t");
+	}
+
+	//
+	// getUint64 () -> uint64_t
+	//
+	uint64_t JSONCompactValue::getUint64() const {
+		if(this->type == UNSIGNED_64)
+			return this->load<uint64_t>();
+		if((this->type == INTEGER || this->type == INTEGER_64) && this->load<int64_t>() >= 0)
+			return static_cast<uint64_t>(this->load<int64_t>());
+
+		throw JSONException("JSONCompactValue is not a positive integer");
+	}
+
+	//
+	// getDouble () -> double
+	//
+	double JSONCompactValue::getDouble() const {
+		switch(this->type) {
+			case INTEGER: case INTEGER_64:
+				return static_cast<double>(this->load<int64_t>());
+			case UNSIGNED_64:
+				return static_cast<double>(this->load<uint64_t>());
+			case DOUBLE:
+				return this->load<double>();
+			default:
+				throw JSONException("JSONCompactValue is not a number");
+		}
+	}
+
+	//
+	// getString () -> std::string_view
+	//
+	std::string_view JSONCompactValue::getString() const {
+		if(this->type == SHORT_STRING)
+			return std::string_view(reinterpret_cast<const char*>(this->payload), this->length);
+		if(this->type == LONG_STRING)
+			return std::string_view(this->load<const char*>(), this->load<uint32_t>(sizeof(char*)));
+
+		throw JSONException("JSONCompactValue is not a string");
+	}
+
+	//
+	// getObject () -> JSONCompactObject&
+	//
+	JSONCompactObject& JSONCompactValue::getObject() {
+		if(this->type != OBJECT)
+			throw JSONException("JSONCompactValue is not an object");
+		return *this->load<JSONCompactObject*>();
+	}
+
+	//
+	// getObject () -> const JSONCompactObject&
+	//
+	const JSONCompactObject& JSONCompactValue::getObject() const {
+		if(this->type != OBJECT)
+			throw JSONException("JSONCompactValue is not an object");
+		return *this->load<JSONCompactObject*>();
+	}
+
+	//
+	// getArray () -> JSONCompactArray&
+	//
+	JSONCompactArray& JSONCompactValue::getArray() {
+		if(this->type != ARRAY)
+			throw JSONException("JSONCompactValue is not an array");
+		return *this->load<JSONCompactArray*>();
+	}
+
+	//
+	// getArray () -> const JSONCompactArray&
+	//
+	const JSONCompactArray& JSONCompactValue::getArray() const {
+		if(this->type != ARRAY)
+			throw JSONException("JSONCompactValue is not an array");
+		return *this->load<JSONCompactArray*>();
+	}
+
+	//
+	// fromJSONValue (const JSONValue&) -> JSONCompactValue
+	//
+	JSONCompactValue JSONCompactValue::fromJSONValue(const JSONValue& value) {
+		return std::visit([](const auto& v) -> JSONCompactValue {
+			using T = std::decay_t<decltype(v)>;
+
+			if constexpr(std::is_same_v<T, JSONObject>) {
+				JSONCompactObject object;
+				object.reserve(v.size());
+				for(const auto& member : v)
+					object.emplace(member.first, JSONCompactValue::fromJSONValue(member.second));
+				return JSONCompactValue(std::move(object));
+			}
+			else if constexpr(std::is_same_v<T, JSONArray>) {
+				JSONCompactArray array;
+				array.reserve(v.size());
+				for(const JSONValue& element : v)
+					array.push_back(JSONCompactValue::fromJSONValue(element));
+				return JSONCompactValue(std::move(array));
+			}
+			else
+				return JSONCompactValue(v);
+		}, value);
+	}
+
+	//
+	// toJSONValue () -> JSONValue
+	//
+	JSONValue JSONCompactValue::toJSONValue() const {
+		switch(this->type) {
+			case BOOLEAN:
+				return this->load<bool>();
+			case INTEGER:
+				return static_cast<int>(this->load<int64_t>());
+			case INTEGER_64:
+				return this->load<int64_t>();
+			case UNSIGNED_64:
+				return this->load<uint64_t>();
+			case DOUBLE:
+				return this->load<double>();
+			case SHORT_STRING: case LONG_STRING:
+				return std::string(this->getString());
+
+			case OBJECT: {
+				const JSONCompactObject& members = this->getObject();
+				JSONObject object;
+				object.reserve(members.size());
+				for(const auto& member : members)
+					object.emplace(member.first, member.second.toJSONValue());
+				return object;
+			}
+
+			case ARRAY: {
+				const JSONCompactArray& elements = this->getArray();
+				JSONArray array;
+				array.reserve(elements.size());
+				for(const JSONCompactValue& element : elements)
+					array.push_back(element.toJSONValue());
+				return array;
+			}
+
+			default:
+				return std::monostate();
+		}
+	}
+
+	//
+	// operator== (const JSONCompactValue&) -> bool
+	//
+	bool JSONCompactValue::operator==(const JSONCompactValue& other) const {
+		// Integers are equal by value, whichever type holds them
+		if(this->isInteger() && other.isInteger()) {
+			if(this->type == UNSIGNED_64 || other.type == UNSIGNED_64)
+				return (this->type == UNSIGNED_64 || this->load<int64_t>() >= 0) &&
+						(other.type == UNSIGNED_64 || other.load<int64_t>() >= 0) &&
+						this->load<uint64_t>() == other.load<uint64_t>();
+			return this->load<int64_t>() == other.load<int64_t>();
+		}
+
+		if(this->isString() && other.isString())
+			return this->getString() == other.getString();
+		if(this->type != other.type)
+			return false;
+
+		switch(this->type) {
+			case BOOLEAN:
+				return this->load<bool>() == other.load<bool>();
+			case DOUBLE:
+				return this->load<double>() == other.load<double>();
+			case OBJECT:
+				return this->getObject() == other.getObject();
+			case ARRAY:
+				return this->getArray() == other.getArray();
+			default:
+				return true;
+		}
+	}
+
+	//
+	// copyFrom (const JSONCompactValue&) -> void
+	//
+	void JSONCompactValue::copyFrom(const JSONCompactValue& copy) {
+		switch(copy.type) {
+			case LONG_STRING:
+				*this = JSONCompactValue(copy.getString());
+				break;
+			case OBJECT:
+				*this = JSONCompactValue(JSONCompactObject(copy.getObject()));
+				break;
+			case ARRAY:
+				*this = JSONCompactValue(JSONCompactArray(copy.getArray()));
+				break;
+
+			// Everything else is held in the value itself
+			default:
+				std::memcpy(this->payload, copy.payload, sizeof(this->payload));
+				this->length = copy.length;
+				this->type = copy.type;
+		}
+	}
+
+	//
+	// release () -> void
+	//
+	void JSONCompactValue::release() {
+		switch(this->type) {
+			case LONG_STRING:
+				delete[] this->load<char*>();
+				break;
+			case OBJECT:
+				delete this->load<JSONCompactObject*>();
+				break;
+			case ARRAY:
+				delete this->load<JSONCompactArray*>();
+				break;
+			default:
+				break;
+		}
+		this->type = NULL_TYPE;
+	}
+
+	//
+	// Destructor
+	//
+	JSONCompactValue::~JSONCompactValue() {
+		this->release();
+	}
+
+	// The builder of compact values is instantiated here, once for the library
+	template class JSONBasicBuilder<JSONCompactTraits>;
+}
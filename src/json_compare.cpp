@@ -6,7 +6,7 @@
  *  
  *  @author		Gabriel Shelton	sheltongabe
  *  @date		  08-02-2018
- *  @version	0.4
+ *  @version	0.5
  */
 
 // for std::abs
@@ -16,9 +16,9 @@
 
 namespace json {
 	//
-	// operator() (double&) -> bool
+	// operator() (const double&) -> bool
 	//
-	bool JSONCompare::operator() (double& right) {
+	bool JSONCompare::operator() (const double& right) {
 		// get the left value as a double
 		double leftValue;
 		try {
@@ -33,28 +33,23 @@ namespace json {
 	}
 
 	//
-	// operator() (JSONObject&) -> bool
+	// operator() (const JSONObject&) -> bool
 	//
-	bool JSONCompare::operator() (JSONObject& right) {
+	bool JSONCompare::operator() (const JSONObject& right) {
 		// Get the left value as a JSONObject
-		JSONObject leftValue;
-		try {
-			leftValue = std::get<JSONObject>(this->left);
-		}
-		catch(std::bad_variant_access& e) {
-			// left does not store JSONObject
+		const JSONObject* leftValue = std::get_if<JSONObject>(&this->left);
+		if(leftValue == nullptr)
 			return false;
-		}
 
 		// Test for differing size
-		if(leftValue.size() != right.size())
+		if(leftValue->size() != right.size())
 			return false;
 
-		// Move through both left and right
-		for(auto leftCur = leftValue.begin(), rightCur = right.begin();
-				leftCur != leftValue.end();
-				++leftCur, ++rightCur) {
-			if(!std::visit(JSONCompare{leftCur->second}, rightCur->second))
+		// Members can be in any order, so look each one up by its key
+		for(auto& rightMember : right) {
+			auto leftMember = leftValue->find(rightMember.first);
+			if(leftMember == leftValue->end() ||
+					!std::visit(JSONCompare{leftMember->second}, rightMember.second))
 				return false;
 		}
 
@@ -63,25 +58,21 @@ namespace json {
 	}
 
 	//
-	// operator() (JSONArray const&) -> bool
+	// operator() (const JSONArray&) -> bool
 	//
-	bool JSONCompare::operator() (JSONArray& right) {
+	bool JSONCompare::operator() (const JSONArray& right) {
 		// get the left value as a JSONArray
-		JSONArray leftValue;
-		try {
-			leftValue = std::get<JSONArray>(this->left);
-		}
-		catch(std::bad_variant_access& e) {
+		const JSONArray* leftValue = std::get_if<JSONArray>(&this->left);
+		if(leftValue == nullptr)
 			return false;
-		}
 
 		// Test for differing size
-		if(leftValue.size() != right.size())
+		if(leftValue->size() != right.size())
 			return false;
 
 		// Move through the arrays and test each element with visit
-		for(auto leftCur = leftValue.begin(), rightCur = right.begin();
-				leftCur != leftValue.end();
+		for(auto leftCur = leftValue->begin(), rightCur = right.begin();
+				leftCur != leftValue->end();
 				++leftCur, ++rightCur) {
 			if(!std::visit(JSONCompare{*leftCur}, *rightCur))
 				return false;
@@ -92,9 +83,9 @@ namespace json {
 	}
 
 	//
-	// operator() (std::monostate&) -> bool
+	// operator() (const std::monostate&) -> bool
 	//
-	bool JSONCompare::operator() (std::monostate& right) {
+	bool JSONCompare::operator() (const std::monostate& right) {
 		if(std::holds_alternative<std::monostate>(this->left))
 			return true;
 		else
@@ -102,20 +93,33 @@ namespace json {
 	}
 
 	//
-	// operator() (T const&) -> bool
+	// operator() (const T&) -> bool
 	//
 	template<typename T>
-	bool JSONCompare::operator() (T& right) {
-		// Get the value as the same type as T
-		T leftValue;
-		try {
-			leftValue = std::get<T>(this->left);
-		}
-		catch(std::bad_variant_access& e) {
-			// left is not the same type as right
+	bool JSONCompare::operator() (const T& right) {
+		// Integers are compared by value across int, int64_t and uint64_t
+		if constexpr(std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+			if(const int* leftValue = std::get_if<int>(&this->left))
+				return JSONCompare::integerEqual(*leftValue, right);
+			if(const int64_t* leftValue = std::get_if<int64_t>(&this->left))
+				return JSONCompare::integerEqual(*leftValue, right);
+			if(const uint64_t* leftValue = std::get_if<uint64_t>(&this->left))
+				return JSONCompare::integerEqual(*leftValue, right);
 			return false;
 		}
 
-		return leftValue == right;
+		// Get the value as the same type as T, left is not equal if it is another type
+		const T* leftValue = std::get_if<T>(&this->left);
+		if(leftValue == nullptr)
+			return false;
+
+		return *leftValue == right;
 	}
-}
\ No newline at end of file
+
+	// Instantiate the generic comparison for the remaining JSONValue types
+	template bool JSONCompare::operator()<int>(const int&);
+	template bool JSONCompare::operator()<std::string>(const std::string&);
+	template bool JSONCompare::operator()<bool>(const bool&);
+	template bool JSONCompare::operator()<int64_t>(const int64_t&);
+	template bool JSONCompare::operator()<uint64_t>(const uint64_t&);
+}
@@ -0,0 +1,132 @@
+/**
+ *  @file		json_cursor.cpp
+ *  @brief	  Implement the non-trivial reads of the JSONCursor
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.2
+ */
+
+#include "json_cursor.h"
+#include "json_string.h"
+
+namespace json {
+	//
+	// readString () -> std::string_view
+	//
+	std::string_view JSONCursor::readString() {
+		// With an index both quotes of the string are known
+		const char* close = nullptr;
+		if(this->token != nullptr && this->seekToken() &&
+				this->begin + *this->token == this->current && this->token + 1 < this->tokenEnd) {
+			close = this->begin + this->token[1];
+			this->token += 2;
+			++this->current;
+		}
+		// Otherwise find the closing quote, which is the same as the opening one
+		else {
+			const char flag = *this->current++;
+			close = JSONString::findClose(this->current, this->end, flag);
+		}
+
+		if(close == nullptr)
+			this->fail("Unterminated string in json text");
+
+		// Build the view and move past the closing quote
+		std::string_view text(this->current, close - this->current);
+		this->current = close + 1;
+		return text;
+	}
+
+	//
+	// readToken () -> std::string_view
+	//
+	std::string_view JSONCursor::readToken() {
+		const char* start = this->current;
+
+		// With an index the token runs up to the next indexed position, less whitespace
+		if(this->token != nullptr && this->seekToken() &&
+				this->begin + *this->token == this->current) {
+			++this->token;
+			const char* stop = (this->token < this->tokenEnd) ?
+					this->begin + *this->token : this->end;
+			while(stop > start && JSONCursor::isWhitespace(stop[-1]))
+				--stop;
+
+			this->current = stop;
+			return std::string_view(start, stop - start);
+		}
+
+		// Read until a character that cannot be a part of a bare value
+		while(this->current < this->end) {
+			switch(*this->current) {
+				case ',': case ':': case '}': case ']':
+				case ' ': case '\n': case '\r': case '\t':
+					return std::string_view(start, this->current - start);
+
+				default:
+					++this->current;
+			}
+		}
+
+		return std::string_view(start, this->current - start);
+	}
+
+	//
+	// skipValue () -> void
+	//
+	void JSONCursor::skipValue() {
+		switch(this->peekNonSpace()) {
+			case '"': case '\'':
+				this->readString();
+				return;
+
+			case '{': case '[':
+				break;
+
+			case '\0':
+				this->fail("Unexpected end of json text");
+
+			default:
+				this->readToken();
+				return;
+		}
+
+		// Match brackets until the container that was opened is closed
+		int depth = 0;
+		do {
+			switch(this->peek()) {
+				case '{': case '[':
+					++depth;
+					break;
+
+				case '}': case ']':
+					--depth;
+					break;
+
+				case '"': case '\'':
+					this->readString();
+					continue;
+
+				case '\0':
+					if(this->atEnd())
+						this->fail("Unterminated container in json text");
+					break;
+
+				default:
+					break;
+			}
+			++this->current;
+		} while(depth > 0);
+	}
+
+	//
+	// fail (const char*) -> void
+	//
+	void JSONCursor::fail(const char* context) const {
+		throw JSONException(std::string(context) + " at offset " +
+				std::to_string(this->offset()));
+	}
+}
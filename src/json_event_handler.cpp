@@ -0,0 +1,47 @@
+/**
+ *  @file		json_event_handler.cpp
+ *  @brief	  Implement reporting values to handlers and building JSON from events
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include "json_event_handler.h"
+#include "json_exception.h"
+
+namespace json {
+	//
+	// onValue (const JSONValue&) -> void
+	//
+	void JSONEventHandler::onValue(const JSONValue& value) {
+		if(const int* i = std::get_if<int>(&value))
+			this->onInt(*i);
+		else if(const int64_t* i64 = std::get_if<int64_t>(&value))
+			this->onInt64(*i64);
+		else if(const uint64_t* u64 = std::get_if<uint64_t>(&value))
+			this->onUint64(*u64);
+		else if(const double* d = std::get_if<double>(&value))
+			this->onDouble(*d);
+		else if(const std::string* s = std::get_if<std::string>(&value))
+			this->onString(*s);
+		else if(const bool* b = std::get_if<bool>(&value))
+			this->onBool(*b);
+		else if(std::holds_alternative<std::monostate>(value))
+			this->onNull();
+		else
+			throw JSONException("Only scalar values can be reported with onValue");
+	}
+
+	//
+	// Destructor
+	//
+	JSONEventHandler::~JSONEventHandler() {
+
+	}
+
+	// The builder of JSONValues is instantiated here, once for the library
+	template class JSONBasicBuilder<JSONValueTraits>;
+}
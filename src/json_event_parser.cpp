@@ -0,0 +1,261 @@
+/**
+ *  @file		json_event_parser.cpp
+ *  @brief	  Implement the state machine of the push parser
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include "json_event_parser.h"
+#include "json_string.h"
+#include "json_text_parser.h"
+
+namespace json {
+	//
+	// Initializing Constructor
+	//
+	JSONEventParser::JSONEventParser(JSONEventHandler& handler) :
+			handler(handler) {
+		this->reset();
+	}
+
+	//
+	// feed (const char*, std::size_t) -> void
+	//
+	void JSONEventParser::feed(const char* data, std::size_t length) {
+		const char* p = data;
+		const char* end = data + length;
+
+		while(p < end) {
+			// Finish a string that was cut off by the end of the last chunk
+			if(this->openQuote != '\0') {
+				// An odd run of backslashes at the end of the last chunk escapes the first character
+				std::size_t backslashes = 0;
+				while(backslashes < this->pending.size() &&
+						this->pending[this->pending.size() - 1 - backslashes] == '\\')
+					++backslashes;
+
+				const char* close = JSONString::findClose(p, end, this->openQuote, backslashes % 2 == 1);
+				if(close == nullptr) {
+					this->pending.append(p, end);
+					break;
+				}
+
+				this->pending.append(p, close);
+				this->openQuote = '\0';
+				p = close + 1;
+
+				this->endString(this->pending);
+				this->pending.clear();
+				continue;
+			}
+
+			// Finish a token that was cut off by the end of the last chunk
+			if(this->inToken) {
+				const char* stop = p;
+				while(stop < end && !JSONEventParser::isDelimiter(*stop))
+					++stop;
+
+				this->pending.append(p, stop);
+				p = stop;
+				if(stop == end)
+					break;
+
+				this->inToken = false;
+				this->endToken(this->pending, this->consumed + (p - data) - this->pending.size());
+				this->pending.clear();
+				continue;
+			}
+
+			const char c = *p;
+			if(c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+				++p;
+				continue;
+			}
+
+			// Strings can be a key or a value, read them the same way
+			if((c == '"' || c == '\'') &&
+					(this->state == VALUE || this->state == ARRAY_VALUE || this->state == OBJECT_KEY)) {
+				const char* close = JSONString::findClose(p + 1, end, c);
+
+				// Report strings that are whole in this chunk straight from it
+				if(close != nullptr) {
+					this->endString(std::string_view(p + 1, close - p - 1));
+					p = close + 1;
+				}
+				else {
+					this->openQuote = c;
+					this->pending.assign(p + 1, end);
+					p = end;
+				}
+				continue;
+			}
+
+			switch(this->state) {
+				case VALUE:
+				case ARRAY_VALUE:
+					if(c == '{') {
+						this->handler.onStartObject();
+						this->containers.push_back('{');
+						this->state = OBJECT_KEY;
+						++p;
+					}
+					else if(c == '[') {
+						this->handler.onStartArray();
+						this->containers.push_back('[');
+						this->state = ARRAY_VALUE;
+						++p;
+					}
+					else if(c == ']' && this->state == ARRAY_VALUE) {
+						this->containers.pop_back();
+						this->handler.onEndArray();
+						this->endValue();
+						++p;
+					}
+					else if(JSONEventParser::isDelimiter(c))
+						this->fail("Error parsing value in json text", this->consumed + (p - data));
+					// A bare token, which may continue in the next chunk
+					else {
+						const char* stop = p;
+						while(stop < end && !JSONEventParser::isDelimiter(*stop))
+							++stop;
+
+						if(stop == end) {
+							this->inToken = true;
+							this->pending.assign(p, stop);
+						}
+						else
+							this->endToken(std::string_view(p, stop - p), this->consumed + (p - data));
+						p = stop;
+					}
+					break;
+
+				case OBJECT_KEY:
+					if(c != '}')
+						this->fail("Error parsing key of object in json text", this->consumed + (p - data));
+
+					this->containers.pop_back();
+					this->handler.onEndObject();
+					this->endValue();
+					++p;
+					break;
+
+				case COLON:
+					if(c != ':')
+						this->fail("Error parsing Object in json text", this->consumed + (p - data));
+
+					this->state = VALUE;
+					++p;
+					break;
+
+				case AFTER_VALUE:
+					// A comma continues the open container
+					if(c == ',') {
+						this->state = (this->containers.back() == '{') ? OBJECT_KEY : ARRAY_VALUE;
+						++p;
+					}
+					// Otherwise it has to be closed by the matching bracket
+					else if(c == '}' && this->containers.back() == '{') {
+						this->containers.pop_back();
+						this->handler.onEndObject();
+						this->endValue();
+						++p;
+					}
+					else if(c == ']' && this->containers.back() == '[') {
+						this->containers.pop_back();
+						this->handler.onEndArray();
+						this->endValue();
+						++p;
+					}
+					else
+						this->fail("Error parsing json text", this->consumed + (p - data));
+					break;
+
+				case DONE:
+					this->fail("Unexpected text after the json value", this->consumed + (p - data));
+			}
+		}
+
+		this->consumed += length;
+	}
+
+	//
+	// finish () -> void
+	//
+	void JSONEventParser::finish() {
+		if(this->openQuote != '\0')
+			this->fail("Unterminated string in json text", this->consumed);
+
+		// A token at the very end is only known to be whole now
+		if(this->inToken) {
+			this->inToken = false;
+			this->endToken(this->pending, this->consumed - this->pending.size());
+			this->pending.clear();
+		}
+
+		if(this->state != DONE)
+			this->fail("Unexpected end of json text", this->consumed);
+
+		this->reset();
+	}
+
+	//
+	// reset () -> void
+	//
+	void JSONEventParser::reset() {
+		this->state = VALUE;
+		this->containers.clear();
+		this->pending.clear();
+		this->openQuote = '\0';
+		this->inToken = false;
+		this->consumed = 0;
+	}
+
+	//
+	// endString (std::string_view) -> void
+	//
+	void JSONEventParser::endString(std::string_view text) {
+		text = JSONString::unescaped(text, this->characters);
+		if(this->state == OBJECT_KEY) {
+			this->handler.onKey(text);
+			this->state = COLON;
+		}
+		else {
+			this->handler.onString(text);
+			this->endValue();
+		}
+	}
+
+	//
+	// endToken (std::string_view, std::size_t) -> void
+	//
+	void JSONEventParser::endToken(std::string_view text, std::size_t offset) {
+		JSONValue value;
+		try {
+			value = JSONTextParser::convertBaseValue(text);
+		}
+		catch(JSONException&) {
+			this->fail("Error parsing value in json text", offset);
+		}
+
+		this->handler.onValue(value);
+		this->endValue();
+	}
+
+	//
+	// fail (const char*, std::size_t) -> void
+	//
+	void JSONEventParser::fail(const char* context, std::size_t offset) const {
+		throw JSONException(std::string(context) + " at offset " + std::to_string(offset));
+	}
+
+	//
+	// Destructor
+	//
+	JSONEventParser::~JSONEventParser() {
+
+	}
+}
@@ -7,17 +7,27 @@
  *  
  *  @author		Gabriel Shelton	sheltongabe
  *  @date		  07-29-2018
- *  @version	0.2
+ *  @version	0.3
  */
 
 #include "json_file.h"
+#include "json_serializer.h"
+#include "json_writer.h"
 #include "jsonable.h"
 
 #include <sstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace json {
 	// Set Default File Extension
 	std::string JSONFile::FILE_EXTENSION = std::move(".json");
+	std::string JSONFile::LINES_FILE_EXTENSION = ".ndjson";
+
+	// Stream files 64KB at a time
+	std::size_t JSONFile::CHUNK_SIZE = 64 * 1024;
 
 	//
 	// Default Constructor
@@ -37,68 +47,201 @@ namespace json {
 	// readJSON (std::string) -> JSON
 	//
 	JSON JSONFile::readJSON(std::string filename) {
-		// Read the file into jsonText
-		std::string jsonText = JSONFile::read(filename);
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename))
+			filename += JSONFile::FILE_EXTENSION;
 
-		// parse the JSON and then return the object
-		JSON j = JSONTextParser::parse(jsonText);
-		return std::move(j);
+		// Map the file and parse the JSON straight out of the mapping
+		JSONMappedFile file(filename);
+		return JSONTextParser::parse(file.getText());
 	}
 
 	//
-	// writeJSON (std::string, JSON) -> bool
+	// readJSON (std::string, JSONThreadPool&) -> JSON
 	//
-	bool JSONFile::writeJSON(std::string filename, JSON j) {
-		// Parse the JSON with the text builder
-		std::string jsonText = JSONParser::parse(j);
+	JSON JSONFile::readJSON(std::string filename, JSONThreadPool& pool) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename))
+			filename += JSONFile::FILE_EXTENSION;
 
-		// write it to the file using the internal method
-		return JSONFile::write(filename, jsonText);
+		JSONMappedFile file(filename);
+		return JSONTextParser::parseParallel(file.getText(), pool);
 	}
 
 	//
-	// writeJSON (std::string, JSONAble) -> bool
+	// readLazy (std::string) -> JSONLazyDocument
 	//
-	bool JSONFile::writeJSON(std::string filename, JSONAble& object) {
-		return JSONFile::writeJSON(filename, object.getJSON());
+	JSONLazyDocument JSONFile::readLazy(std::string filename) {
+		return JSONLazyDocument(JSONFile::read(filename));
 	}
 
-	// 
-	// read (std::string) -> std::string
 	//
-	std::string JSONFile::read(std::string filename) {
+	// readArena (std::string) -> JSONArenaDocument
+	//
+	JSONArenaDocument JSONFile::readArena(std::string filename) {
 		// Check the file extension and correct if needed
 		if(!checkExtension(filename))
 			filename += JSONFile::FILE_EXTENSION;
 
-		// Variable to store the final output
-		std::string output = "";
+		JSONMappedFile file(filename);
+		return JSONArenaDocument(file.getText());
+	}
 
-		// Open and read the JSON string
-		try {
-			// Variables to read in the data
-			std::stringstream s;
-			std::string line;
-			std::ifstream jsonFile(filename);
-			
-			// Read the file, until you run out of file to read
-			while(!jsonFile.eof()) {
-				jsonFile >> line;
-				s << line;
-			}
-
-			// close the stream and set the output
-			jsonFile.close();
-			output = s.str();
+	//
+	// readEvents (std::string, JSONEventHandler&) -> void
+	//
+	void JSONFile::readEvents(std::string filename, JSONEventHandler& handler) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename))
+			filename += JSONFile::FILE_EXTENSION;
+
+		std::ifstream jsonFile(filename, std::ios::binary);
+		if(!jsonFile)
+			throw JSONException("Error reading data in json file: " + filename);
+
+		// Push the file through the parser one chunk at a time
+		JSONEventParser parser(handler);
+		std::vector<char> chunk(JSONFile::CHUNK_SIZE);
+		while(jsonFile) {
+			jsonFile.read(chunk.data(), chunk.size());
+			parser.feed(chunk.data(), static_cast<std::size_t>(jsonFile.gcount()));
 		}
-		// If there is an error, throw an JSONException telling that there was an
-		// error reading the file
-		catch(std::exception e) {
+
+		if(jsonFile.bad())
 			throw JSONException("Error reading data in json file: " + filename);
+		parser.finish();
+	}
+
+	//
+	// readLines (std::string, const std::function<void(JSON&)>&, JSONThreadPool&) -> void
+	//
+	void JSONFile::readLines(std::string filename,
+			const std::function<void(JSON&)>& onRecord, JSONThreadPool& pool) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename, JSONFile::LINES_FILE_EXTENSION))
+			filename += JSONFile::LINES_FILE_EXTENSION;
+
+		// The mapping outlives every batch parsed from it
+		JSONMappedFile file(filename);
+		JSONTextParser::parseLines(file.getText(), onRecord, pool);
+	}
+
+	//
+	// appendLines (std::string, const std::vector<JSON>&) -> bool
+	//
+	bool JSONFile::appendLines(std::string filename, const std::vector<JSON>& records) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename, JSONFile::LINES_FILE_EXTENSION))
+			filename += JSONFile::LINES_FILE_EXTENSION;
+
+		// Build every line in one buffer first so the file is written in one go
+		JSONSerializer lines(true);
+		for(const JSON& record : records) {
+			lines.write(record);
+			lines.writeRaw("\n");
 		}
 
-		// if the input had no errors, return the contents of the file in output
-		return std::move(output);
+		std::ofstream jsonFile(filename, std::ios::binary | std::ios::app);
+		jsonFile.write(lines.getText().data(), lines.getText().size());
+		jsonFile.close();
+		if(!jsonFile)
+			throw JSONException("Error writing data to the file: " + filename);
+
+		return true;
+	}
+
+	//
+	// appendLine (std::string, const JSON&) -> bool
+	//
+	bool JSONFile::appendLine(std::string filename, const JSON& record) {
+		return JSONFile::appendLines(std::move(filename), std::vector<JSON>{record});
+	}
+
+	//
+	// writeJSON (std::string, const JSON&) -> bool
+	//
+	bool JSONFile::writeJSON(std::string filename, const JSON& j) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename))
+			filename += JSONFile::FILE_EXTENSION;
+
+		// Serialize straight into the file a buffer at a time, the whole text is never held
+		std::ofstream jsonFile(filename, std::ios::binary);
+		JSONStreamSink sink(jsonFile);
+		JSONSerializer serializer(sink);
+		serializer.write(j);
+		serializer.flush();
+
+		jsonFile.close();
+		if(!jsonFile)
+			throw JSONException("Error writing data to the file: " + filename);
+
+		return true;
+	}
+
+	//
+	// writeJSON (std::string, const JSON&, JSONThreadPool&) -> bool
+	//
+	bool JSONFile::writeJSON(std::string filename, const JSON& j, JSONThreadPool& pool) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename))
+			filename += JSONFile::FILE_EXTENSION;
+
+		// Written to the descriptor, so the finished chunks go out in one writev
+		const int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if(fd < 0)
+			throw JSONException("Error writing data to the file: " + filename);
+
+		try {
+			JSONDescriptorSink sink(fd);
+			JSONSerializer serializer(sink);
+			serializer.writeParallel(j, pool);
+			serializer.flush();
+		}
+		catch(...) {
+			::close(fd);
+			throw;
+		}
+
+		if(::close(fd) != 0)
+			throw JSONException("Error writing data to the file: " + filename);
+
+		return true;
+	}
+
+	//
+	// writeJSON (std::string, const JSONAble&) -> bool
+	//
+	bool JSONFile::writeJSON(std::string filename, const JSONAble& object) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename))
+			filename += JSONFile::FILE_EXTENSION;
+
+		// The object writes itself into the file, no JSON map is built unless it asks for one
+		std::ofstream jsonFile(filename, std::ios::binary);
+		JSONStreamSink sink(jsonFile);
+		JSONWriter writer(sink);
+		writer.value(object);
+		writer.flush();
+
+		jsonFile.close();
+		if(!jsonFile)
+			throw JSONException("Error writing data to the file: " + filename);
+
+		return true;
+	}
+
+	// 
+	// read (std::string) -> std::string
+	//
+	std::string JSONFile::read(std::string filename) {
+		// Check the file extension and correct if needed
+		if(!checkExtension(filename))
+			filename += JSONFile::FILE_EXTENSION;
+
+		// Copy the mapped file, whitespace and all, into the string
+		JSONMappedFile file(filename);
+		return std::string(file.getText());
 	}
 
 	// 
@@ -129,15 +272,22 @@ namespace json {
 	// checkExtension (std::string) -> bool
 	//
 	bool JSONFile::checkExtension(std::string filename) {
-		// use a reverse find to try and see if the FILE_EXTENSION is in the string, 
+		return JSONFile::checkExtension(filename, JSONFile::FILE_EXTENSION);
+	}
+
+	// 
+	// checkExtension (const std::string&, const std::string&) -> bool
+	//
+	bool JSONFile::checkExtension(const std::string& filename, const std::string& extension) {
+		// use a reverse find to try and see if the extension is in the string, 
 		// or the index it starts
-		const size_t lastFind = filename.rfind(JSONFile::FILE_EXTENSION);
+		const size_t lastFind = filename.rfind(extension);
 		if(lastFind == std::string::npos)
 			return false;
 
 		// If the File Extension is present ensure it is at the end of the file name
 		else
-			return (filename.length() - JSONFile::FILE_EXTENSION.length()) == lastFind;
+			return (filename.length() - extension.length()) == lastFind;
 	}
 
 	// 
@@ -0,0 +1,106 @@
+/**
+ *  @file		json_key.cpp
+ *  @brief	  Build and free keys, and intern them in a pool
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <limits>
+#include <new>
+
+#include "json_exception.h"
+#include "json_key.h"
+
+namespace json {
+	//
+	// Initializing Constructor
+	//
+	JSONKey::JSONKey(std::string_view text) :
+			bytes{} {
+		// Short keys are kept in the key, the last byte holding their length
+		if(text.size() <= JSONKey::INLINE_CAPACITY) {
+			std::memcpy(this->bytes, text.data(), text.size());
+			this->bytes[JSONKey::INLINE_CAPACITY] = static_cast<unsigned char>(text.size());
+			return;
+		}
+
+		if(text.size() > std::numeric_limits<uint32_t>::max())
+			throw JSONException("Key too long for a JSONKey");
+
+		// Long keys are one block, the header followed by the characters
+		void* block = ::operator new(sizeof(Shared) + text.size());
+		Shared* shared = new(block) Shared;
+		shared->references.store(1, std::memory_order_relaxed);
+		shared->length = static_cast<uint32_t>(text.size());
+		shared->hash = std::hash<std::string_view>{}(text);
+		std::memcpy(reinterpret_cast<char*>(shared + 1), text.data(), text.size());
+
+		std::memcpy(this->bytes, &shared, sizeof(shared));
+		this->bytes[JSONKey::INLINE_CAPACITY] = JSONKey::SHARED;
+	}
+
+	//
+	// release () -> void
+	//
+	void JSONKey::release() {
+		Shared* shared = this->getShared();
+		if(shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			shared->~Shared();
+			::operator delete(shared);
+		}
+		std::memset(this->bytes, 0, sizeof(this->bytes));
+	}
+
+	//
+	// Default Constructor
+	//
+	JSONKeyPool::JSONKeyPool() {
+
+	}
+
+	//
+	// intern (std::string_view) -> JSONKey
+	//
+	JSONKey JSONKeyPool::intern(std::string_view text) {
+		// Short keys have nothing to share
+		if(text.size() <= JSONKey::INLINE_CAPACITY)
+			return JSONKey(text);
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		auto found = this->keys.find(text);
+		if(found != this->keys.end())
+			return found->second;
+
+		// The table is keyed by a view of the characters the new key owns
+		JSONKey key(text);
+		this->keys.emplace(key.view(), key);
+		return key;
+	}
+
+	//
+	// size () -> std::size_t
+	//
+	std::size_t JSONKeyPool::size() const {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return this->keys.size();
+	}
+
+	//
+	// clear () -> void
+	//
+	void JSONKeyPool::clear() {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->keys.clear();
+	}
+
+	//
+	// Destructor
+	//
+	JSONKeyPool::~JSONKeyPool() {
+
+	}
+}
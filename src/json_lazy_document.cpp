@@ -0,0 +1,239 @@
+/**
+ *  @file		json_lazy_document.cpp
+ *  @brief	  Implement lookups that skip over everything they are not looking for
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include "json_lazy_document.h"
+#include "json_string.h"
+#include "json_text_parser.h"
+
+namespace json {
+	//
+	// Default Constructor
+	//
+	JSONLazyValue::JSONLazyValue() {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONLazyValue::JSONLazyValue(std::string_view text) :
+			text(text) {
+
+	}
+
+	//
+	// operator[] (std::string_view) -> JSONLazyValue
+	//
+	JSONLazyValue JSONLazyValue::operator[](std::string_view key) const {
+		if(!this->isObject())
+			return JSONLazyValue();
+
+		// Step into the object
+		JSONCursor s(this->text);
+		s.get();
+
+		// Move through the members, skipping the values of every other key
+		std::string scratch;
+		while(s.peekNonSpace() != '}') {
+			std::string_view currentKey = JSONString::unescaped(s.readString(), scratch);
+			s.expect(':', "Error parsing Object in json text");
+
+			if(currentKey == key)
+				return JSONLazyValue::skipToNext(s);
+			s.skipValue();
+
+			if(s.peekNonSpace() == ',')
+				s.get();
+		}
+
+		return JSONLazyValue();
+	}
+
+	//
+	// operator[] (std::size_t) -> JSONLazyValue
+	//
+	JSONLazyValue JSONLazyValue::operator[](std::size_t index) const {
+		if(!this->isArray())
+			return JSONLazyValue();
+
+		// Step into the array
+		JSONCursor s(this->text);
+		s.get();
+
+		// Skip the elements before the one wanted
+		for(std::size_t i = 0; s.peekNonSpace() != ']'; ++i) {
+			if(i == index)
+				return JSONLazyValue::skipToNext(s);
+			s.skipValue();
+
+			if(s.peekNonSpace() == ',')
+				s.get();
+		}
+
+		return JSONLazyValue();
+	}
+
+	//
+	// size () -> std::size_t
+	//
+	std::size_t JSONLazyValue::size() const {
+		if(!this->isObject() && !this->isArray())
+			return 0;
+
+		// Step into the container
+		JSONCursor s(this->text);
+		const char close = (s.get() == '{') ? '}' : ']';
+
+		// Count the values skipped, for objects the key is skipped first
+		std::size_t count = 0;
+		while(s.peekNonSpace() != close) {
+			if(close == '}') {
+				s.readString();
+				s.expect(':', "Error parsing Object in json text");
+			}
+			s.skipValue();
+			++count;
+
+			if(s.peekNonSpace() == ',')
+				s.get();
+		}
+
+		return count;
+	}
+
+	//
+	// materialize () -> JSONValue
+	//
+	JSONValue JSONLazyValue::materialize() const {
+		if(!this->exists())
+			throw JSONException("Value does not exist in the json document");
+
+		return JSONTextParser::parseValue(this->text);
+	}
+
+	//
+	// skipToNext (JSONCursor&) -> JSONLazyValue
+	//
+	JSONLazyValue JSONLazyValue::skipToNext(JSONCursor& s) {
+		s.skipWhitespace();
+		const char* start = s.current;
+		s.skipValue();
+		return JSONLazyValue(std::string_view(start, s.current - start));
+	}
+
+	//
+	// Destructor
+	//
+	JSONLazyValue::~JSONLazyValue() {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONLazyDocument::JSONLazyDocument(std::string text) :
+			text(std::move(text)) {
+		// Check the whole text once, so lookups only need to match brackets
+		JSONCursor s(this->text);
+		std::string scratch;
+		JSONLazyDocument::validate(s, scratch);
+
+		s.skipWhitespace();
+		if(!s.atEnd())
+			s.fail("Unexpected text after the json value");
+	}
+
+	//
+	// getRoot () -> JSONLazyValue
+	//
+	JSONLazyValue JSONLazyDocument::getRoot() const {
+		// Trim the whitespace around the root value
+		std::string_view root(this->text);
+		while(!root.empty() && JSONCursor::isWhitespace(root.front()))
+			root.remove_prefix(1);
+		while(!root.empty() && JSONCursor::isWhitespace(root.back()))
+			root.remove_suffix(1);
+
+		return JSONLazyValue(root);
+	}
+
+	//
+	// validate (JSONCursor&, std::string&) -> void
+	//
+	void JSONLazyDocument::validate(JSONCursor& s, std::string& scratch) {
+		switch(s.peekNonSpace()) {
+			case '{':
+				s.get();
+				while(s.peekNonSpace() != '}') {
+					const char starter = s.peek();
+					if(starter != '"' && starter != '\'')
+						s.fail("Error parsing key of object in json text");
+					JSONString::unescaped(s.readString(), scratch);
+
+					s.expect(':', "Error parsing Object in json text");
+					JSONLazyDocument::validate(s, scratch);
+
+					// A comma continues the object, otherwise it has to end
+					const char next = s.peekNonSpace();
+					if(next == ',')
+						s.get();
+					else if(next != '}')
+						s.fail("Error parsing Object in json text");
+				}
+				s.get();
+				break;
+
+			case '[':
+				s.get();
+				while(s.peekNonSpace() != ']') {
+					JSONLazyDocument::validate(s, scratch);
+
+					// A comma continues the array, otherwise it has to end
+					const char next = s.peekNonSpace();
+					if(next == ',')
+						s.get();
+					else if(next != ']')
+						s.fail("Error parsing array");
+				}
+				s.get();
+				break;
+
+			case '"': case '\'':
+				JSONString::unescaped(s.readString(), scratch);
+				break;
+
+			case '\0':
+				s.fail("Unexpected end of json text");
+
+			// Bare values are checked by the same rules the parser uses
+			default:
+			{
+				const std::size_t start = s.offset();
+				const std::string_view token = s.readToken();
+				try {
+					JSONTextParser::convertBaseValue(token);
+				}
+				catch(JSONException&) {
+					throw JSONException("Error parsing value in json text at offset " +
+							std::to_string(start));
+				}
+			}
+			break;
+		}
+	}
+
+	//
+	// Destructor
+	//
+	JSONLazyDocument::~JSONLazyDocument() {
+
+	}
+}
@@ -0,0 +1,71 @@
+/**
+ *  @file		json_mapped_file.cpp
+ *  @brief	  Map and unmap files with mmap
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "json_mapped_file.h"
+
+namespace json {
+	//
+	// Initializing Constructor
+	//
+	JSONMappedFile::JSONMappedFile(const std::string& filename) :
+			data(nullptr),
+			length(0) {
+		const int fd = ::open(filename.c_str(), O_RDONLY);
+		if(fd == -1)
+			throw JSONException("Error reading data in json file: " + filename);
+
+		struct stat info;
+		if(::fstat(fd, &info) == -1) {
+			::close(fd);
+			throw JSONException("Error reading data in json file: " + filename);
+		}
+
+		// Empty files cannot be mapped, and have no text anyway
+		this->length = static_cast<std::size_t>(info.st_size);
+		if(this->length > 0) {
+			void* mapping = ::mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(mapping == MAP_FAILED) {
+				::close(fd);
+				throw JSONException("Error mapping json file: " + filename);
+			}
+
+			// The parsers read the file front to back
+			::madvise(mapping, this->length, MADV_SEQUENTIAL);
+			this->data = static_cast<const char*>(mapping);
+		}
+
+		// The mapping stays valid once the descriptor is closed
+		::close(fd);
+	}
+
+	//
+	// Move Constructor
+	//
+	JSONMappedFile::JSONMappedFile(JSONMappedFile&& other) :
+			data(other.data),
+			length(other.length) {
+		other.data = nullptr;
+		other.length = 0;
+	}
+
+	//
+	// Destructor
+	//
+	JSONMappedFile::~JSONMappedFile() {
+		if(this->data != nullptr)
+			::munmap(const_cast<char*>(this->data), this->length);
+	}
+}
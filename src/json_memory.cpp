@@ -0,0 +1,193 @@
+/**
+ *  @file		json_memory.cpp
+ *  @brief	  Walk documents adding up their memory, and count the allocations of a parse
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <variant>
+
+#include "json_exception.h"
+#include "json_memory.h"
+#include "json_text_parser.h"
+
+#ifdef JSON_UTIL_TRACK_ALLOCATIONS
+namespace {
+	/// Room kept before each allocation for its size, a multiple of the alignment new gives
+	constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+
+	// Counted for the calling thread only, while tracking is set
+	thread_local bool tracking = false;
+	thread_local long long liveBytes = 0;
+	thread_local long long peakBytes = 0;
+	thread_local std::size_t allocations = 0;
+}
+
+//
+// operator new (std::size_t) -> void*
+//
+void* operator new(std::size_t size) {
+	void* block = std::malloc(size + HEADER_SIZE);
+	if(block == nullptr)
+		throw std::bad_alloc();
+	*static_cast<std::size_t*>(block) = size;
+
+	if(tracking) {
+		++allocations;
+		liveBytes += static_cast<long long>(size);
+		if(liveBytes > peakBytes)
+			peakBytes = liveBytes;
+	}
+	return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+//
+// operator delete (void*) -> void
+//
+void operator delete(void* memory) noexcept {
+	if(memory == nullptr)
+		return;
+
+	void* block = static_cast<char*>(memory) - HEADER_SIZE;
+	if(tracking)
+		liveBytes -= static_cast<long long>(*static_cast<std::size_t*>(block));
+	std::free(block);
+}
+
+//
+// operator delete (void*, std::size_t) -> void
+//
+void operator delete(void* memory, std::size_t) noexcept {
+	::operator delete(memory);
+}
+#endif
+
+namespace json {
+	//
+	// measure (const JSON&) -> JSONMemoryUsage
+	//
+	JSONMemoryUsage JSONMemory::measure(const JSON& j) {
+		JSONMemoryUsage usage;
+		std::unordered_set<const void*> blocks;
+
+		++usage.objects;
+		usage.containerBytes += sizeof(JSON);
+		JSONMemory::measureMembers(j, usage, blocks);
+		return usage;
+	}
+
+	//
+	// measure (const JSONValue&) -> JSONMemoryUsage
+	//
+	JSONMemoryUsage JSONMemory::measure(const JSONValue& value) {
+		JSONMemoryUsage usage;
+		std::unordered_set<const void*> blocks;
+
+		JSONMemory::measureValue(value, usage, blocks);
+		return usage;
+	}
+
+	//
+	// measureParse (std::string_view) -> JSONParseMemory
+	//
+	JSONParseMemory JSONMemory::measureParse([[maybe_unused]] std::string_view jsonText) {
+#ifdef JSON_UTIL_TRACK_ALLOCATIONS
+		JSONParseMemory memory;
+		liveBytes = 0;
+		peakBytes = 0;
+		allocations = 0;
+
+		tracking = true;
+		try {
+			JSON j = JSONTextParser::parse(jsonText);
+			tracking = false;
+
+			memory.document = JSONMemory::measure(j);
+		}
+		catch(...) {
+			tracking = false;
+			throw;
+		}
+
+		memory.peakBytes = static_cast<std::size_t>(peakBytes);
+		memory.allocations = allocations;
+		return memory;
+#else
+		throw JSONException("Measuring a parse needs the library built with TRACK_ALLOCATIONS");
+#endif
+	}
+
+	//
+	// isTrackingAllocations () -> bool
+	//
+	bool JSONMemory::isTrackingAllocations() {
+#ifdef JSON_UTIL_TRACK_ALLOCATIONS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	//
+	// measureValue (const JSONValue&, JSONMemoryUsage&, std::unordered_set<const void*>&) -> void
+	//
+	void JSONMemory::measureValue(const JSONValue& value, JSONMemoryUsage& usage,
+			std::unordered_set<const void*>& blocks) {
+		if(const std::string* s = std::get_if<std::string>(&value)) {
+			// Short strings are kept inside the std::string, with nothing allocated
+			const char* inside = reinterpret_cast<const char*>(s);
+			if(s->data() < inside || s->data() >= inside + sizeof(std::string))
+				usage.stringBytes += s->capacity() + 1;
+			++usage.strings;
+		}
+		else if(const JSONObject* object = std::get_if<JSONObject>(&value)) {
+			++usage.objects;
+			JSONMemory::measureMembers(*object, usage, blocks);
+		}
+		else if(const JSONArray* array = std::get_if<JSONArray>(&value)) {
+			++usage.arrays;
+			usage.containerBytes += array->capacity() * sizeof(JSONValue);
+			for(const JSONValue& element : *array)
+				JSONMemory::measureValue(element, usage, blocks);
+		}
+		else if(std::holds_alternative<int>(value))
+			++usage.ints;
+		else if(std::holds_alternative<int64_t>(value))
+			++usage.int64s;
+		else if(std::holds_alternative<uint64_t>(value))
+			++usage.uint64s;
+		else if(std::holds_alternative<double>(value))
+			++usage.doubles;
+		else if(std::holds_alternative<bool>(value))
+			++usage.bools;
+		else
+			++usage.nulls;
+	}
+
+	//
+	// measureMembers (const JSON&, JSONMemoryUsage&, std::unordered_set<const void*>&) -> void
+	//
+	void JSONMemory::measureMembers(const JSON& j, JSONMemoryUsage& usage,
+			std::unordered_set<const void*>& blocks) {
+		usage.containerBytes += j.getAllocatedBytes();
+		for(const auto& member : j) {
+			++usage.keys;
+			if(member.first.isShared()) {
+				++usage.sharedKeys;
+
+				// Interned and copied keys share a block, which is only counted the first time
+				if(blocks.insert(member.first.data()).second)
+					usage.keyBytes += member.first.getAllocatedBytes();
+			}
+
+			JSONMemory::measureValue(member.second, usage, blocks);
+		}
+	}
+}
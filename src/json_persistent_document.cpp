@@ -0,0 +1,293 @@
+/**
+ *  @file		json_persistent_document.cpp
+ *  @brief	  Build, read, compare and update persistent documents
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <string>
+
+#include "json_compare.h"
+#include "json_persistent_document.h"
+
+namespace json {
+	//
+	// Initializing Constructor
+	//
+	JSONPersistentValue::JSONPersistentValue(const JSONValue& value) {
+		// Null needs no node
+		if(std::holds_alternative<std::monostate>(value))
+			return;
+
+		// Containers are built whole, from the bottom up
+		auto node = std::make_shared<Node>();
+		if(const JSONObject* object = std::get_if<JSONObject>(&value)) {
+			std::vector<JSONPersistentObject::value_type> members;
+			members.reserve(object->size());
+			for(const auto& member : *object)
+				members.emplace_back(member.first, JSONPersistentValue(member.second));
+			node->value.emplace<JSONPersistentObject>(std::move(members));
+		}
+		else if(const JSONArray* array = std::get_if<JSONArray>(&value)) {
+			std::vector<JSONPersistentValue> elements;
+			elements.reserve(array->size());
+			for(const JSONValue& element : *array)
+				elements.emplace_back(element);
+			node->value.emplace<JSONPersistentArray>(std::move(elements));
+		}
+		else
+			node->value.emplace<JSONValue>(value);
+
+		this->node = std::move(node);
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONPersistentValue::JSONPersistentValue(JSONPersistentObject&& object) :
+			node(std::make_shared<const Node>(Node{std::move(object)})) {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONPersistentValue::JSONPersistentValue(JSONPersistentArray&& array) :
+			node(std::make_shared<const Node>(Node{std::move(array)})) {
+
+	}
+
+	//
+	// isNull () -> bool
+	//
+	bool JSONPersistentValue::isNull() const {
+		if(!this->node)
+			return true;
+
+		const JSONValue* scalar = std::get_if<JSONValue>(&this->node->value);
+		return scalar != nullptr && std::holds_alternative<std::monostate>(*scalar);
+	}
+
+	//
+	// isObject () -> bool
+	//
+	bool JSONPersistentValue::isObject() const {
+		return this->node && std::holds_alternative<JSONPersistentObject>(this->node->value);
+	}
+
+	//
+	// isArray () -> bool
+	//
+	bool JSONPersistentValue::isArray() const {
+		return this->node && std::holds_alternative<JSONPersistentArray>(this->node->value);
+	}
+
+	//
+	// getScalar () -> const JSONValue&
+	//
+	const JSONValue& JSONPersistentValue::getScalar() const {
+		// Every null handle reads as the same null value
+		static const JSONValue NULL_VALUE = std::monostate();
+		if(!this->node)
+			return NULL_VALUE;
+
+		const JSONValue* scalar = std::get_if<JSONValue>(&this->node->value);
+		if(scalar == nullptr)
+			throw JSONException("Persistent json value is not a scalar");
+		return *scalar;
+	}
+
+	//
+	// getObject () -> const JSONPersistentObject&
+	//
+	const JSONPersistentObject& JSONPersistentValue::getObject() const {
+		if(!this->isObject())
+			throw JSONException("Persistent json value is not an object");
+		return std::get<JSONPersistentObject>(this->node->value);
+	}
+
+	//
+	// getArray () -> const JSONPersistentArray&
+	//
+	const JSONPersistentArray& JSONPersistentValue::getArray() const {
+		if(!this->isArray())
+			throw JSONException("Persistent json value is not an array");
+		return std::get<JSONPersistentArray>(this->node->value);
+	}
+
+	//
+	// toJSONValue () -> JSONValue
+	//
+	JSONValue JSONPersistentValue::toJSONValue() const {
+		if(this->isObject()) {
+			JSONObject object;
+			object.reserve(this->getObject().size());
+			for(const auto& member : this->getObject())
+				object.emplace(member.first, member.second.toJSONValue());
+			return object;
+		}
+
+		if(this->isArray()) {
+			JSONArray array;
+			array.reserve(this->getArray().size());
+			for(const JSONPersistentValue& element : this->getArray())
+				array.push_back(element.toJSONValue());
+			return array;
+		}
+
+		return this->getScalar();
+	}
+
+	//
+	// operator== (const JSONPersistentValue&) -> bool
+	//
+	bool JSONPersistentValue::operator==(const JSONPersistentValue& other) const {
+		// A shared value is equal to itself
+		if(this->shares(other))
+			return true;
+
+		// Objects match members by key in any order, arrays element by element
+		if(this->isObject() || other.isObject())
+			return this->isObject() && other.isObject() && this->getObject() == other.getObject();
+		if(this->isArray() || other.isArray())
+			return this->isArray() && other.isArray() && this->getArray() == other.getArray();
+
+		return std::visit(JSONCompare{this->getScalar()}, other.getScalar());
+	}
+
+	//
+	// Default Constructor
+	//
+	JSONPersistentDocument::JSONPersistentDocument() :
+			root(JSONPersistentObject()) {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONPersistentDocument::JSONPersistentDocument(const JSON& json) {
+		std::vector<JSONPersistentObject::value_type> members;
+		members.reserve(json.size());
+		for(const auto& member : json)
+			members.emplace_back(member.first, JSONPersistentValue(member.second));
+		this->root = JSONPersistentValue(JSONPersistentObject(std::move(members)));
+	}
+
+	//
+	// get (const JSONPath&) -> const JSONPersistentValue&
+	//
+	const JSONPersistentValue& JSONPersistentDocument::get(const JSONPath& path) const {
+		const JSONPersistentValue* current = &this->root;
+		for(const JSONPathStep& step : path) {
+			if(const JSONKey* key = std::get_if<JSONKey>(&step)) {
+				if(!current->isObject())
+					throw JSONException("Path expects an object at the key: " + key->str());
+				auto found = current->getObject().find(*key);
+				if(found == current->getObject().end())
+					throw JSONException("Path has no member with the key: " + key->str());
+				current = &found->second;
+			}
+			else {
+				std::size_t index = std::get<std::size_t>(step);
+				if(!current->isArray() || index >= current->getArray().size())
+					throw JSONException("Path has no element at the index: " + std::to_string(index));
+				current = &current->getArray()[index];
+			}
+		}
+
+		return *current;
+	}
+
+	//
+	// operator[] (std::string_view) -> const JSONPersistentValue&
+	//
+	const JSONPersistentValue& JSONPersistentDocument::operator[](std::string_view key) const {
+		const JSONPersistentObject& object = this->root.getObject();
+		auto found = object.find(key);
+		if(found == object.end())
+			throw JSONException("No json member with the key: " + std::string(key));
+		return found->second;
+	}
+
+	//
+	// set (const JSONPath&, JSONPersistentValue) -> JSONPersistentDocument
+	//
+	JSONPersistentDocument JSONPersistentDocument::set(const JSONPath& path,
+			JSONPersistentValue value) const {
+		return JSONPersistentDocument(
+				JSONPersistentDocument::update(this->root, path.begin(), path.end(), &value));
+	}
+
+	//
+	// erase (const JSONPath&) -> JSONPersistentDocument
+	//
+	JSONPersistentDocument JSONPersistentDocument::erase(const JSONPath& path) const {
+		if(path.empty())
+			throw JSONException("Cannot erase the root of a document");
+		return JSONPersistentDocument(
+				JSONPersistentDocument::update(this->root, path.begin(), path.end(), nullptr));
+	}
+
+	//
+	// toJSON () -> JSON
+	//
+	JSON JSONPersistentDocument::toJSON() const {
+		JSON json;
+		json.reserve(this->root.getObject().size());
+		for(const auto& member : this->root.getObject())
+			json.emplace(member.first, member.second.toJSONValue());
+		return json;
+	}
+
+	//
+	// update (const JSONPersistentValue&, iterator, iterator, JSONPersistentValue*) -> JSONPersistentValue
+	//
+	JSONPersistentValue JSONPersistentDocument::update(const JSONPersistentValue& current,
+			JSONPath::const_iterator step, JSONPath::const_iterator end,
+			JSONPersistentValue* value) {
+		// The end of the path is replaced by the value
+		if(step == end)
+			return *value;
+		const bool last = (step + 1 == end);
+
+		// Copy the path through the object to the member, sharing the rest of it
+		if(const JSONKey* key = std::get_if<JSONKey>(&*step)) {
+			if(!current.isObject())
+				throw JSONException("Path expects an object at the key: " + key->str());
+			const JSONPersistentObject& object = current.getObject();
+			auto found = object.find(*key);
+
+			if(last && value == nullptr) {
+				if(found == object.end())
+					throw JSONException("Path has no member with the key: " + key->str());
+				return JSONPersistentValue(object.erase(*key));
+			}
+			if(last)
+				return JSONPersistentValue(object.set(*key, std::move(*value)));
+			if(found == object.end())
+				throw JSONException("Path has no member with the key: " + key->str());
+			return JSONPersistentValue(object.set(*key,
+					JSONPersistentDocument::update(found->second, step + 1, end, value)));
+		}
+
+		// Copy the path through the array to the element the same way
+		std::size_t index = std::get<std::size_t>(*step);
+		if(!current.isArray())
+			throw JSONException("Path expects an array at the index: " + std::to_string(index));
+		const JSONPersistentArray& array = current.getArray();
+
+		if(last && value != nullptr && index == array.size())
+			return JSONPersistentValue(array.append(std::move(*value)));
+		if(index >= array.size())
+			throw JSONException("Path has no element at the index: " + std::to_string(index));
+		if(last && value == nullptr)
+			return JSONPersistentValue(array.erase(index));
+		return JSONPersistentValue(array.set(index,
+				JSONPersistentDocument::update(array[index], step + 1, end, value)));
+	}
+}
@@ -0,0 +1,164 @@
+/**
+ *  @file		json_pointer.cpp
+ *  @brief	  Compile JSON Pointers and follow them through documents
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include <variant>
+
+#include "json_pointer.h"
+
+namespace json {
+	//
+	// Initializing Constructor
+	//
+	JSONPointer::JSONPointer(std::string_view pointer) :
+			text(pointer), hash(std::hash<std::string>{}(this->text)) {
+		if(pointer.empty())
+			return;
+		if(pointer[0] != '/')
+			throw JSONException("Json pointer must start with '/': " + this->text);
+
+		// Each token runs from after its '/' to the next one
+		std::size_t start = 1;
+		while(true) {
+			std::size_t end = pointer.find('/', start);
+			if(end == std::string_view::npos)
+				end = pointer.size();
+			std::string_view escaped = pointer.substr(start, end - start);
+
+			// Unescape, '~1' is '/' and '~0' is '~'
+			std::string key;
+			key.reserve(escaped.size());
+			for(std::size_t i = 0; i < escaped.size(); ++i) {
+				if(escaped[i] != '~')
+					key += escaped[i];
+				else if(i + 1 < escaped.size() && (escaped[i + 1] == '0' || escaped[i + 1] == '1'))
+					key += (escaped[++i] == '0') ? '~' : '/';
+				else
+					throw JSONException("Json pointer has a '~' not followed by '0' or '1': " + this->text);
+			}
+
+			// An array index is "0" or digits without a leading zero
+			std::size_t index = JSONPointer::NO_INDEX;
+			if(!key.empty() && key.size() <= 18 && (key == "0" || key[0] != '0') &&
+					key.find_first_not_of("0123456789") == std::string::npos)
+				index = std::stoull(key);
+
+			JSONKey token(key);
+			const std::size_t keyHash = token.getHash();
+			this->tokens.push_back(Token{std::move(token), keyHash, index});
+
+			if(end == pointer.size())
+				break;
+			start = end + 1;
+		}
+	}
+
+	//
+	// find (const JSONValue&) -> const JSONValue*
+	//
+	const JSONValue* JSONPointer::find(const JSONValue& root) const {
+		const JSONValue* current = &root;
+		for(const Token& token : this->tokens) {
+			current = JSONPointer::step(*current, token);
+			if(current == nullptr)
+				return nullptr;
+		}
+		return current;
+	}
+
+	//
+	// find (const JSON&) -> const JSONValue*
+	//
+	const JSONValue* JSONPointer::find(const JSON& j) const {
+		if(this->tokens.empty())
+			return nullptr;
+
+		const JSONValue* current = JSONPointer::step(j, this->tokens.front());
+		for(std::size_t i = 1; i < this->tokens.size() && current != nullptr; ++i)
+			current = JSONPointer::step(*current, this->tokens[i]);
+		return current;
+	}
+
+	//
+	// get (const JSON&) -> const JSONValue&
+	//
+	const JSONValue& JSONPointer::get(const JSON& j) const {
+		const JSONValue* value = this->find(j);
+		if(value == nullptr)
+			throw JSONException("No json value at the pointer: " + this->text);
+		return *value;
+	}
+
+	//
+	// step (const JSONValue&, const Token&) -> const JSONValue*
+	//
+	const JSONValue* JSONPointer::step(const JSONValue& value, const Token& token) {
+		if(const JSONObject* object = std::get_if<JSONObject>(&value))
+			return JSONPointer::step(static_cast<const JSON&>(*object), token);
+
+		if(const JSONArray* array = std::get_if<JSONArray>(&value)) {
+			if(token.index >= array->size())
+				return nullptr;
+			return &(*array)[token.index];
+		}
+
+		return nullptr;
+	}
+
+	//
+	// step (const JSON&, const Token&) -> const JSONValue*
+	//
+	const JSONValue* JSONPointer::step(const JSON& j, const Token& token) {
+		auto found = j.find(token.key, token.hash);
+		return (found == j.end()) ? nullptr : &found->second;
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONPathIndex::JSONPathIndex(JSON& document) :
+			document(document) {
+
+	}
+
+	//
+	// add (const JSONPointer&) -> JSONValue*
+	//
+	JSONValue* JSONPathIndex::add(const JSONPointer& pointer) {
+		JSONValue* value = pointer.find(this->document);
+		this->values.insert_or_assign(pointer, value);
+		return value;
+	}
+
+	//
+	// find (const JSONPointer&) -> JSONValue*
+	//
+	JSONValue* JSONPathIndex::find(const JSONPointer& pointer) {
+		auto found = this->values.find(pointer);
+		if(found != this->values.end())
+			return found->second;
+		return this->add(pointer);
+	}
+
+	//
+	// rebuild () -> void
+	//
+	void JSONPathIndex::rebuild() {
+		for(auto& entry : this->values)
+			entry.second = entry.first.find(this->document);
+	}
+
+	//
+	// Destructor
+	//
+	JSONPathIndex::~JSONPathIndex() {
+
+	}
+}
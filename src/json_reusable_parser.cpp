@@ -0,0 +1,113 @@
+/**
+ *  @file		json_reusable_parser.cpp
+ *  @brief	  Parse and write documents with buffers kept between calls
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <variant>
+
+#include "json_reusable_parser.h"
+#include "json_text_parser.h"
+
+namespace json {
+	//
+	// Default Constructor
+	//
+	JSONReusableParser::JSONReusableParser() :
+			tapeParser(tapeBuilder), arenaBuilder(&pools), arenaParser(arenaBuilder),
+			prettyWriter(false), compactWriter(true) {
+
+	}
+
+	//
+	// parseTape (std::string_view) -> const JSONTape&
+	//
+	const JSONTape& JSONReusableParser::parseTape(std::string_view jsonText) {
+		try {
+			this->tapeParser.feed(jsonText);
+			this->tapeParser.finish();
+		}
+		catch(...) {
+			// Drop the partial document, keeping the buffers for the next one
+			this->tapeParser.reset();
+			this->tapeBuilder.reset();
+			throw;
+		}
+
+		this->tapeBuilder.swapTape(this->tape);
+		return this->tape;
+	}
+
+	//
+	// parseArena (std::string_view) -> const JSONArenaValue&
+	//
+	const JSONArenaValue& JSONReusableParser::parseArena(std::string_view jsonText) {
+		// Give the last value's memory back to the pools to build the new one in
+		this->arenaRoot = std::monostate();
+
+		try {
+			this->arenaParser.feed(jsonText);
+			this->arenaParser.finish();
+		}
+		catch(...) {
+			this->arenaParser.reset();
+			this->arenaBuilder.reset();
+			throw;
+		}
+
+		this->arenaRoot = this->arenaBuilder.takeValue();
+		return this->arenaRoot;
+	}
+
+	//
+	// parse (std::string_view) -> JSON
+	//
+	JSON JSONReusableParser::parse(std::string_view jsonText) {
+		// Documents with keys that never repeat would grow the pool forever, so it
+		// starts over once it is full.  Keys handed out already stay valid
+		if(this->keys.size() >= JSONReusableParser::MAX_POOLED_KEYS)
+			this->keys.clear();
+		return JSONTextParser::parse(jsonText, this->keys);
+	}
+
+	//
+	// write (const JSON&, bool) -> std::string_view
+	//
+	std::string_view JSONReusableParser::write(const JSON& j, bool compact) {
+		JSONSerializer& writer = compact ? this->compactWriter : this->prettyWriter;
+		writer.clear();
+		writer.write(j);
+		return writer.getText();
+	}
+
+	//
+	// clear () -> void
+	//
+	void JSONReusableParser::clear() {
+		// The builder holds the last tape's buffers, so both sets are freed
+		this->tapeParser.reset();
+		this->tapeBuilder.release();
+		this->tape = JSONTape();
+
+		this->arenaParser.reset();
+		this->arenaRoot = std::monostate();
+		this->arenaBuilder.reset();
+		this->pools.release();
+
+		this->keys.clear();
+		this->prettyWriter.takeText();
+		this->compactWriter.takeText();
+	}
+
+	//
+	// Destructor
+	//
+	JSONReusableParser::~JSONReusableParser() {
+
+	}
+}
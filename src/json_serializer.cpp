@@ -0,0 +1,354 @@
+/**
+ *  @file		json_serializer.cpp
+ *  @brief	  Append the text of documents to the serializer's buffer
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <future>
+#include <utility>
+#include <variant>
+
+#include "json_exception.h"
+#include "json_serializer.h"
+#include "json_string.h"
+
+namespace json {
+	// Initialize static variables
+	std::size_t JSONSerializer::FLUSH_SIZE = 64 * 1024;
+	std::size_t JSONSerializer::INITIAL_SIZE = 256;
+
+	// Below this many members the workers would spend longer starting than formatting
+	std::size_t JSONSerializer::PARALLEL_THRESHOLD = 4096;
+
+	// Small enough that the chunks waiting for the sink take little memory
+	std::size_t JSONSerializer::PARALLEL_CHUNK_SIZE = 16 * 1024;
+
+	//
+	// Initializing Constructor
+	//
+	JSONSerializer::JSONSerializer(bool compact, std::string indent) :
+			sink(nullptr), compact(compact), indent(std::move(indent)), newlines("\n") {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONSerializer::JSONSerializer(JSONSink& sink, bool compact, std::string indent) :
+			sink(&sink), compact(compact), indent(std::move(indent)), newlines("\n") {
+		this->buffer.reserve(JSONSerializer::FLUSH_SIZE * 2);
+	}
+
+	//
+	// write (const JSON&) -> void
+	//
+	void JSONSerializer::write(const JSON& j) {
+		this->writeObject(j, 0);
+		this->flushIfFull();
+	}
+
+	//
+	// write (const JSONValue&) -> void
+	//
+	void JSONSerializer::write(const JSONValue& value) {
+		this->writeValue(value, 0);
+		this->flushIfFull();
+	}
+
+	//
+	// writeParallel (const JSON&, JSONThreadPool&) -> void
+	//
+	void JSONSerializer::writeParallel(const JSON& j, JSONThreadPool& pool) {
+		if(j.size() < JSONSerializer::PARALLEL_THRESHOLD)
+			return this->write(j);
+
+		this->writeChunks(j.size(), '{', '}', [&j](JSONSerializer& chunk, std::size_t first, std::size_t last) {
+			chunk.writeMembers(j, first, last, 0);
+		}, pool);
+		this->flushIfFull();
+	}
+
+	//
+	// writeParallel (const JSONValue&, JSONThreadPool&) -> void
+	//
+	void JSONSerializer::writeParallel(const JSONValue& value, JSONThreadPool& pool) {
+		if(const JSONObject* object = std::get_if<JSONObject>(&value))
+			return this->writeParallel(static_cast<const JSON&>(*object), pool);
+
+		const JSONArray* array = std::get_if<JSONArray>(&value);
+		if(array == nullptr || array->size() < JSONSerializer::PARALLEL_THRESHOLD)
+			return this->write(value);
+
+		this->writeChunks(array->size(), '[', ']', [array](JSONSerializer& chunk, std::size_t first, std::size_t last) {
+			chunk.writeElements(*array, first, last, 0);
+		}, pool);
+		this->flushIfFull();
+	}
+
+	//
+	// flush () -> void
+	//
+	void JSONSerializer::flush() {
+		if(this->sink == nullptr || this->buffer.empty())
+			return;
+
+		this->sink->write(this->buffer.data(), this->buffer.size());
+		this->buffer.clear();
+	}
+
+	//
+	// serialize (const JSON&, bool) -> std::string
+	//
+	std::string JSONSerializer::serialize(const JSON& j, bool compact) {
+		// Start with room for a small document, so it does not grow a few characters at a time
+		JSONSerializer serializer(compact);
+		serializer.buffer.reserve(JSONSerializer::INITIAL_SIZE);
+		serializer.write(j);
+		return serializer.takeText();
+	}
+
+	//
+	// serializeParallel (const JSON&, bool, JSONThreadPool&) -> std::string
+	//
+	std::string JSONSerializer::serializeParallel(const JSON& j, bool compact, JSONThreadPool& pool) {
+		JSONSerializer serializer(compact);
+		serializer.buffer.reserve(JSONSerializer::INITIAL_SIZE);
+		serializer.writeParallel(j, pool);
+		return serializer.takeText();
+	}
+
+	//
+	// formatDouble (double, char*) -> std::size_t
+	//
+	std::size_t JSONSerializer::formatDouble(double value, char* out) {
+		if(!std::isfinite(value))
+			throw JSONException("Json cannot hold the double: " + std::to_string(value));
+		char* end = std::to_chars(out, out + JSONSerializer::DOUBLE_SIZE - 2, value).ptr;
+
+		// Whole numbers are written without a point, which would read back as an integer
+		if(std::find_if(out, end, [](char c) {
+				return c == '.' || c == 'e'; }) == end) {
+			*end++ = '.';
+			*end++ = '0';
+		}
+		return end - out;
+	}
+
+	//
+	// newline (std::size_t) -> void
+	//
+	void JSONSerializer::newline(std::size_t depth) {
+		const std::size_t length = 1 + depth * this->indent.size();
+		while(this->newlines.size() < length)
+			this->newlines += this->indent;
+		this->buffer.append(this->newlines, 0, length);
+	}
+
+	//
+	// writeObject (const JSON&, std::size_t) -> void
+	//
+	void JSONSerializer::writeObject(const JSON& j, std::size_t depth) {
+		this->buffer += '{';
+		this->writeMembers(j, 0, j.size(), depth);
+
+		if(!this->compact)
+			this->newline(depth);
+		this->buffer += '}';
+	}
+
+	//
+	// writeArray (const JSONArray&, std::size_t) -> void
+	//
+	void JSONSerializer::writeArray(const JSONArray& array, std::size_t depth) {
+		this->buffer += '[';
+		this->writeElements(array, 0, array.size(), depth);
+
+		if(!this->compact)
+			this->newline(depth);
+		this->buffer += ']';
+	}
+
+	//
+	// writeMembers (const JSON&, std::size_t, std::size_t, std::size_t) -> void
+	//
+	void JSONSerializer::writeMembers(const JSON& j, std::size_t first, std::size_t last, std::size_t depth) {
+		for(auto current = j.begin() + first; current != j.begin() + last; ++current) {
+			if(current != j.begin())
+				this->buffer += ',';
+			if(!this->compact)
+				this->newline(depth + 1);
+
+			this->writeString(current->first.view());
+			this->buffer.append(this->compact ? ":" : " : ");
+			this->writeValue(current->second, depth + 1);
+			this->flushIfFull();
+		}
+	}
+
+	//
+	// writeElements (const JSONArray&, std::size_t, std::size_t, std::size_t) -> void
+	//
+	void JSONSerializer::writeElements(const JSONArray& array, std::size_t first, std::size_t last,
+			std::size_t depth) {
+		for(auto current = array.begin() + first; current != array.begin() + last; ++current) {
+			if(current != array.begin())
+				this->buffer += ',';
+			if(!this->compact)
+				this->newline(depth + 1);
+
+			this->writeValue(*current, depth + 1);
+			this->flushIfFull();
+		}
+	}
+
+	//
+	// writeChunks (std::size_t, char, char,
+	// 		const std::function<void(JSONSerializer&, std::size_t, std::size_t)>&, JSONThreadPool&) -> void
+	//
+	void JSONSerializer::writeChunks(std::size_t numMembers, char open, char close,
+			const std::function<void(JSONSerializer&, std::size_t, std::size_t)>& writeRange,
+			JSONThreadPool& pool) {
+		// Several chunks per worker so an uneven chunk does not hold up the rest
+		const std::size_t numChunks = std::max<std::size_t>(1, std::min(numMembers, 4 * pool.getNumThreads()));
+		const std::size_t chunkSize = std::min((numMembers + numChunks - 1) / numChunks,
+				JSONSerializer::PARALLEL_CHUNK_SIZE);
+
+		// Chunks being formatted, oldest first, bounded so a huge container is not all held as text
+		std::deque<std::future<std::string>> pending;
+		const std::size_t maxPending = 2 * pool.getNumThreads();
+		std::size_t next = 0;
+		auto submitChunks = [&]() {
+			while(next < numMembers && pending.size() < maxPending) {
+				const std::size_t first = next;
+				const std::size_t last = std::min(first + chunkSize, numMembers);
+				pending.push_back(pool.submit([&writeRange, compact = this->compact, indent = this->indent,
+						first, last]() {
+					JSONSerializer chunk(compact, indent);
+					writeRange(chunk, first, last);
+					return chunk.takeText();
+				}));
+				next = last;
+			}
+		};
+
+		this->buffer += open;
+		try {
+			std::vector<std::string> chunks;
+			submitChunks();
+			while(!pending.empty()) {
+				// Take the oldest chunk, and the ones after it that are already done
+				chunks.clear();
+				do {
+					chunks.push_back(pending.front().get());
+					pending.pop_front();
+				} while(!pending.empty() &&
+						pending.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+
+				// Keep the workers busy while the chunks are written
+				submitChunks();
+				this->appendChunks(chunks);
+			}
+		}
+		// The chunks still queued read the container and writeRange, let them finish first
+		catch(...) {
+			for(std::future<std::string>& chunk : pending) {
+				if(chunk.valid())
+					chunk.wait();
+			}
+			throw;
+		}
+
+		if(!this->compact)
+			this->newline(0);
+		this->buffer += close;
+	}
+
+	//
+	// appendChunks (std::vector<std::string>&) -> void
+	//
+	void JSONSerializer::appendChunks(std::vector<std::string>& chunks) {
+		if(this->sink == nullptr) {
+			for(const std::string& chunk : chunks)
+				this->buffer.append(chunk);
+			return;
+		}
+
+		// The buffer goes first, then each chunk as it is, with no copy into the buffer
+		std::vector<std::string_view> pieces;
+		pieces.reserve(chunks.size() + 1);
+		pieces.emplace_back(this->buffer);
+		for(const std::string& chunk : chunks)
+			pieces.emplace_back(chunk);
+
+		this->sink->writePieces(pieces.data(), pieces.size());
+		this->buffer.clear();
+	}
+
+	//
+	// writeValue (const JSONValue&, std::size_t) -> void
+	//
+	void JSONSerializer::writeValue(const JSONValue& value, std::size_t depth) {
+		// Numbers are formatted on the stack
+		char digits[JSONSerializer::DOUBLE_SIZE];
+		std::to_chars_result written{digits, std::errc()};
+
+		// Cases follow the order of JSONValue's alternatives
+		switch(value.index()) {
+			case 0:
+				written = std::to_chars(digits, digits + sizeof(digits), std::get<int>(value));
+				break;
+			case 1:
+				written.ptr = digits + JSONSerializer::formatDouble(std::get<double>(value), digits);
+				break;
+			case 2:
+				this->writeString(std::get<std::string>(value));
+				return;
+			case 3:
+				this->buffer.append(std::get<bool>(value) ? "true" : "false");
+				return;
+			case 4:
+				this->buffer.append("null");
+				return;
+			case 5:
+				this->writeObject(std::get<JSONObject>(value), depth);
+				return;
+			case 6:
+				this->writeArray(std::get<JSONArray>(value), depth);
+				return;
+			case 7:
+				written = std::to_chars(digits, digits + sizeof(digits), std::get<int64_t>(value));
+				break;
+			case 8:
+				written = std::to_chars(digits, digits + sizeof(digits), std::get<uint64_t>(value));
+				break;
+		}
+
+		this->buffer.append(digits, written.ptr - digits);
+	}
+
+	//
+	// writeString (std::string_view) -> void
+	//
+	void JSONSerializer::writeString(std::string_view s) {
+		this->buffer += '"';
+		JSONString::appendEscaped(s, this->buffer);
+		this->buffer += '"';
+	}
+
+	//
+	// Destructor
+	//
+	JSONSerializer::~JSONSerializer() {
+
+	}
+}
@@ -0,0 +1,375 @@
+/**
+ *  @file		json_string.cpp
+ *  @brief	  Escape and unescape strings, scanning with SIMD kernels picked at runtime
+ *
+ * 	The kernels only find the next interesting character, the escapes
+ * 	themselves are rare and handled one at a time
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JSON_UTIL_X86
+#endif
+
+#include "json_exception.h"
+#include "json_string.h"
+#include "json_structural_index.h"
+
+namespace json {
+	namespace {
+		/// A kernel that finds the first character that has to be escaped
+		using EscapableFinder = const char* (*)(const char*, const char*);
+
+		/// A kernel that finds the first of two characters
+		using PairFinder = const char* (*)(const char*, const char*, char, char);
+
+		/// If a character has to be escaped in a json string
+		inline bool isEscapable(char c) {
+			return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+		}
+
+		//
+		// findEscapableScalar (const char*, const char*) -> const char*
+		//
+		inline const char* findEscapableScalar(const char* p, const char* end) {
+			while(p < end && !isEscapable(*p))
+				++p;
+			return p;
+		}
+
+		//
+		// findPairScalar (const char*, const char*, char, char) -> const char*
+		//
+		inline const char* findPairScalar(const char* p, const char* end, char a, char b) {
+			while(p < end && *p != a && *p != b)
+				++p;
+			return p;
+		}
+
+#ifdef JSON_UTIL_X86
+		//
+		// findEscapableSSE42 (const char*, const char*) -> const char*
+		//
+		__attribute__((target("sse4.2")))
+		const char* findEscapableSSE42(const char* p, const char* end) {
+			const __m128i quote = _mm_set1_epi8('"');
+			const __m128i backslash = _mm_set1_epi8('\\');
+			const __m128i control = _mm_set1_epi8(0x1F);
+
+			for(; end - p >= 16; p += 16) {
+				const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+				// A byte is below 0x20 when its unsigned minimum with 0x1F is itself
+				const __m128i found = _mm_or_si128(
+						_mm_or_si128(_mm_cmpeq_epi8(in, quote), _mm_cmpeq_epi8(in, backslash)),
+						_mm_cmpeq_epi8(_mm_min_epu8(in, control), in));
+				const int bits = _mm_movemask_epi8(found);
+				if(bits != 0)
+					return p + __builtin_ctz(bits);
+			}
+			return findEscapableScalar(p, end);
+		}
+
+		//
+		// findPairSSE42 (const char*, const char*, char, char) -> const char*
+		//
+		__attribute__((target("sse4.2")))
+		const char* findPairSSE42(const char* p, const char* end, char a, char b) {
+			const __m128i first = _mm_set1_epi8(a);
+			const __m128i second = _mm_set1_epi8(b);
+
+			for(; end - p >= 16; p += 16) {
+				const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				const int bits = _mm_movemask_epi8(
+						_mm_or_si128(_mm_cmpeq_epi8(in, first), _mm_cmpeq_epi8(in, second)));
+				if(bits != 0)
+					return p + __builtin_ctz(bits);
+			}
+			return findPairScalar(p, end, a, b);
+		}
+
+		//
+		// findEscapableAVX2 (const char*, const char*) -> const char*
+		//
+		__attribute__((target("avx2")))
+		const char* findEscapableAVX2(const char* p, const char* end) {
+			const __m256i quote = _mm256_set1_epi8('"');
+			const __m256i backslash = _mm256_set1_epi8('\\');
+			const __m256i control = _mm256_set1_epi8(0x1F);
+
+			for(; end - p >= 32; p += 32) {
+				const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+				const __m256i found = _mm256_or_si256(
+						_mm256_or_si256(_mm256_cmpeq_epi8(in, quote), _mm256_cmpeq_epi8(in, backslash)),
+						_mm256_cmpeq_epi8(_mm256_min_epu8(in, control), in));
+				const uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(found));
+				if(bits != 0)
+					return p + __builtin_ctz(bits);
+			}
+
+			// The tail is scanned here, running SSE code while the upper halves of
+			// the registers are dirty would stall every instruction of it
+			return findEscapableScalar(p, end);
+		}
+
+		//
+		// findPairAVX2 (const char*, const char*, char, char) -> const char*
+		//
+		__attribute__((target("avx2")))
+		const char* findPairAVX2(const char* p, const char* end, char a, char b) {
+			const __m256i first = _mm256_set1_epi8(a);
+			const __m256i second = _mm256_set1_epi8(b);
+
+			for(; end - p >= 32; p += 32) {
+				const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+				const uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(
+						_mm256_or_si256(_mm256_cmpeq_epi8(in, first), _mm256_cmpeq_epi8(in, second))));
+				if(bits != 0)
+					return p + __builtin_ctz(bits);
+			}
+
+			// The tail is scanned here, like findEscapableAVX2
+			return findPairScalar(p, end, a, b);
+		}
+#endif
+
+		//
+		// getEscapableFinder (JSONStructuralIndex::Kernel) -> EscapableFinder
+		//
+		EscapableFinder getEscapableFinder(JSONStructuralIndex::Kernel kernel) {
+			switch(JSONStructuralIndex::isSupported(kernel) ? kernel : JSONStructuralIndex::SCALAR) {
+#ifdef JSON_UTIL_X86
+				case JSONStructuralIndex::AVX2:
+					return findEscapableAVX2;
+
+				case JSONStructuralIndex::SSE42:
+					return findEscapableSSE42;
+#endif
+				default:
+					return findEscapableScalar;
+			}
+		}
+
+		//
+		// getPairFinder (JSONStructuralIndex::Kernel) -> PairFinder
+		//
+		PairFinder getPairFinder(JSONStructuralIndex::Kernel kernel) {
+			switch(JSONStructuralIndex::isSupported(kernel) ? kernel : JSONStructuralIndex::SCALAR) {
+#ifdef JSON_UTIL_X86
+				case JSONStructuralIndex::AVX2:
+					return findPairAVX2;
+
+				case JSONStructuralIndex::SSE42:
+					return findPairSSE42;
+#endif
+				default:
+					return findPairScalar;
+			}
+		}
+
+		/// The kernel that finds characters to escape, the fastest one until useKernel picks another
+		EscapableFinder& escapableKernel() {
+			static EscapableFinder kernel = getEscapableFinder(JSONStructuralIndex::getKernel());
+			return kernel;
+		}
+
+		/// The kernel that finds the first of two characters, the fastest one until useKernel picks another
+		PairFinder& pairKernel() {
+			static PairFinder kernel = getPairFinder(JSONStructuralIndex::getKernel());
+			return kernel;
+		}
+
+		/// Find the first character that has to be escaped with the kernel in use
+		inline const char* findEscapableKernel(const char* p, const char* end) {
+			return escapableKernel()(p, end);
+		}
+
+		/// Find the first of two characters with the kernel in use
+		inline const char* findPairKernel(const char* p, const char* end, char a, char b) {
+			return pairKernel()(p, end, a, b);
+		}
+
+		//
+		// readHex (const char*, const char*) -> uint32_t
+		//
+		// Read the 4 hex digits of a \u escape
+		//
+		uint32_t readHex(const char* p, const char* end) {
+			if(end - p < 4)
+				throw JSONException("Unterminated unicode escape in json string");
+
+			uint32_t value = 0;
+			for(int i = 0; i < 4; ++i) {
+				const char c = p[i];
+				value <<= 4;
+				if(c >= '0' && c <= '9')
+					value |= c - '0';
+				else if(c >= 'a' && c <= 'f')
+					value |= c - 'a' + 10;
+				else if(c >= 'A' && c <= 'F')
+					value |= c - 'A' + 10;
+				else
+					throw JSONException("Invalid unicode escape in json string");
+			}
+			return value;
+		}
+
+		//
+		// appendUTF8 (uint32_t, std::string&) -> void
+		//
+		void appendUTF8(uint32_t code, std::string& out) {
+			if(code < 0x80)
+				out += static_cast<char>(code);
+			else if(code < 0x800) {
+				out += static_cast<char>(0xC0 | (code >> 6));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+			else if(code < 0x10000) {
+				out += static_cast<char>(0xE0 | (code >> 12));
+				out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+			else {
+				out += static_cast<char>(0xF0 | (code >> 18));
+				out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+				out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+		}
+	}
+
+	//
+	// findEscapable (const char*, const char*) -> const char*
+	//
+	const char* JSONString::findEscapable(const char* p, const char* end) {
+		return findEscapableKernel(p, end);
+	}
+
+	//
+	// findClose (const char*, const char*, char, bool) -> const char*
+	//
+	const char* JSONString::findClose(const char* p, const char* end, char quote, bool escaped) {
+		if(escaped)
+			++p;
+
+		// Each backslash hides the character after it, which may be the quote
+		while(p < end) {
+			p = findPairKernel(p, end, quote, '\\');
+			if(p == end)
+				break;
+			if(*p == quote)
+				return p;
+			p += 2;
+		}
+		return nullptr;
+	}
+
+	//
+	// appendEscaped (std::string_view, std::string&) -> void
+	//
+	void JSONString::appendEscaped(std::string_view s, std::string& out) {
+		static const char HEX[] = "0123456789abcdef";
+
+		const char* p = s.data();
+		const char* end = p + s.size();
+		while(true) {
+			// Copy the run that needs nothing, then escape the character that ended it
+			const char* stop = findEscapableKernel(p, end);
+			out.append(p, stop - p);
+			if(stop == end)
+				return;
+
+			const char c = *stop;
+			switch(c) {
+				case '"': out.append("\\\"", 2); break;
+				case '\\': out.append("\\\\", 2); break;
+				case '\b': out.append("\\b", 2); break;
+				case '\f': out.append("\\f", 2); break;
+				case '\n': out.append("\\n", 2); break;
+				case '\r': out.append("\\r", 2); break;
+				case '\t': out.append("\\t", 2); break;
+				default: {
+					const char code[] = {'\\', 'u', '0', '0', HEX[(c >> 4) & 0xF], HEX[c & 0xF]};
+					out.append(code, sizeof(code));
+					break;
+				}
+			}
+			p = stop + 1;
+		}
+	}
+
+	//
+	// appendUnescaped (std::string_view, std::string&) -> void
+	//
+	void JSONString::appendUnescaped(std::string_view text, std::string& out) {
+		const char* p = text.data();
+		const char* end = p + text.size();
+		while(true) {
+			const char* stop = findPairKernel(p, end, '\\', '\\');
+			out.append(p, stop - p);
+			if(stop == end)
+				return;
+			if(stop + 1 == end)
+				throw JSONException("Unterminated escape in json string");
+
+			p = stop + 2;
+			switch(stop[1]) {
+				case '"': case '\\': case '/': case '\'':
+					out += stop[1];
+					break;
+				case 'b': out += '\b'; break;
+				case 'f': out += '\f'; break;
+				case 'n': out += '\n'; break;
+				case 'r': out += '\r'; break;
+				case 't': out += '\t'; break;
+				case 'u': {
+					uint32_t code = readHex(p, end);
+					p += 4;
+
+					// A high surrogate followed by a low one is a single code point,
+					// a surrogate on its own is kept as it is
+					if(code >= 0xD800 && code < 0xDC00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+						const uint32_t low = readHex(p + 2, end);
+						if(low >= 0xDC00 && low < 0xE000) {
+							code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+							p += 6;
+						}
+					}
+					appendUTF8(code, out);
+					break;
+				}
+				default:
+					throw JSONException("Invalid escape in json string");
+			}
+		}
+	}
+
+	//
+	// unescaped (std::string_view, std::string&) -> std::string_view
+	//
+	std::string_view JSONString::unescaped(std::string_view text, std::string& scratch) {
+		const char* end = text.data() + text.size();
+		const char* first = findPairKernel(text.data(), end, '\\', '\\');
+		if(first == end)
+			return text;
+
+		// Copy the run before the first escape, which was already scanned
+		scratch.assign(text.data(), first - text.data());
+		JSONString::appendUnescaped(std::string_view(first, end - first), scratch);
+		return scratch;
+	}
+
+	//
+	// useKernel (JSONStructuralIndex::Kernel) -> void
+	//
+	void JSONString::useKernel(JSONStructuralIndex::Kernel kernel) {
+		escapableKernel() = getEscapableFinder(kernel);
+		pairKernel() = getPairFinder(kernel);
+	}
+}
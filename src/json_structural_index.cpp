@@ -0,0 +1,319 @@
+/**
+ *  @file		json_structural_index.cpp
+ *  @brief	  Scan json text for token starts with SIMD kernels picked at runtime
+ *
+ * 	Each kernel only turns 64 bytes into bitmasks of interesting characters,
+ * 	the string tracking and token detection on those masks is shared
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JSON_UTIL_X86
+#endif
+
+#include "json_structural_index.h"
+
+namespace json {
+	namespace {
+		/// Bitmasks of the characters in a 64 byte block, bit i describes byte i
+		using BlockMasks = JSONStructuralIndex::BlockMasks;
+
+		/// A kernel that fills the masks for a block
+		using BlockScanner = void (*)(const char*, BlockMasks&);
+
+		/// Number of bytes handled by one call of a kernel
+		constexpr std::size_t BLOCK_SIZE = 64;
+
+		//
+		// scanBlockScalar (const char*, BlockMasks&) -> void
+		//
+		void scanBlockScalar(const char* block, BlockMasks& m) {
+			m = BlockMasks{0, 0, 0, 0, 0};
+			for(std::size_t i = 0; i < BLOCK_SIZE; ++i) {
+				const uint64_t bit = uint64_t(1) << i;
+				switch(block[i]) {
+					case '"': m.quote |= bit; break;
+					case '\'': m.singleQuote |= bit; break;
+					case '\\': m.backslash |= bit; break;
+					case '{': case '}': case '[': case ']': case ':': case ',':
+						m.op |= bit; break;
+					case ' ': case '\t': case '\n': case '\r':
+						m.whitespace |= bit; break;
+					default: break;
+				}
+			}
+		}
+
+#ifdef JSON_UTIL_X86
+		/// Compare every byte of a 16 byte lane with c
+		__attribute__((target("sse4.2")))
+		inline __m128i equalSSE42(__m128i in, char c) {
+			return _mm_cmpeq_epi8(in, _mm_set1_epi8(c));
+		}
+
+		/// Turn the result of a 16 byte comparison into bits
+		__attribute__((target("sse4.2")))
+		inline uint64_t bitsSSE42(__m128i v) {
+			return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(v)));
+		}
+
+		//
+		// scanBlockSSE42 (const char*, BlockMasks&) -> void
+		//
+		__attribute__((target("sse4.2")))
+		void scanBlockSSE42(const char* block, BlockMasks& m) {
+			m = BlockMasks{0, 0, 0, 0, 0};
+			for(int i = 0; i < 4; ++i) {
+				const __m128i in = _mm_loadu_si128(
+						reinterpret_cast<const __m128i*>(block + 16 * i));
+				const int shift = 16 * i;
+
+				m.quote |= bitsSSE42(equalSSE42(in, '"')) << shift;
+				m.singleQuote |= bitsSSE42(equalSSE42(in, '\'')) << shift;
+				m.backslash |= bitsSSE42(equalSSE42(in, '\\')) << shift;
+
+				const __m128i brackets = _mm_or_si128(
+						_mm_or_si128(equalSSE42(in, '{'), equalSSE42(in, '}')),
+						_mm_or_si128(equalSSE42(in, '['), equalSSE42(in, ']')));
+				const __m128i separators = _mm_or_si128(equalSSE42(in, ':'), equalSSE42(in, ','));
+				m.op |= bitsSSE42(_mm_or_si128(brackets, separators)) << shift;
+
+				const __m128i whitespace = _mm_or_si128(
+						_mm_or_si128(equalSSE42(in, ' '), equalSSE42(in, '\t')),
+						_mm_or_si128(equalSSE42(in, '\n'), equalSSE42(in, '\r')));
+				m.whitespace |= bitsSSE42(whitespace) << shift;
+			}
+		}
+
+		/// Compare every byte of a 32 byte lane with c
+		__attribute__((target("avx2")))
+		inline __m256i equalAVX2(__m256i in, char c) {
+			return _mm256_cmpeq_epi8(in, _mm256_set1_epi8(c));
+		}
+
+		/// Turn the result of a 32 byte comparison into bits
+		__attribute__((target("avx2")))
+		inline uint64_t bitsAVX2(__m256i v) {
+			return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(v)));
+		}
+
+		//
+		// scanBlockAVX2 (const char*, BlockMasks&) -> void
+		//
+		__attribute__((target("avx2")))
+		void scanBlockAVX2(const char* block, BlockMasks& m) {
+			m = BlockMasks{0, 0, 0, 0, 0};
+			for(int i = 0; i < 2; ++i) {
+				const __m256i in = _mm256_loadu_si256(
+						reinterpret_cast<const __m256i*>(block + 32 * i));
+				const int shift = 32 * i;
+
+				m.quote |= bitsAVX2(equalAVX2(in, '"')) << shift;
+				m.singleQuote |= bitsAVX2(equalAVX2(in, '\'')) << shift;
+				m.backslash |= bitsAVX2(equalAVX2(in, '\\')) << shift;
+
+				const __m256i brackets = _mm256_or_si256(
+						_mm256_or_si256(equalAVX2(in, '{'), equalAVX2(in, '}')),
+						_mm256_or_si256(equalAVX2(in, '['), equalAVX2(in, ']')));
+				const __m256i separators = _mm256_or_si256(equalAVX2(in, ':'), equalAVX2(in, ','));
+				m.op |= bitsAVX2(_mm256_or_si256(brackets, separators)) << shift;
+
+				const __m256i whitespace = _mm256_or_si256(
+						_mm256_or_si256(equalAVX2(in, ' '), equalAVX2(in, '\t')),
+						_mm256_or_si256(equalAVX2(in, '\n'), equalAVX2(in, '\r')));
+				m.whitespace |= bitsAVX2(whitespace) << shift;
+			}
+		}
+#endif
+
+		//
+		// getScanner (JSONStructuralIndex::Kernel) -> BlockScanner
+		//
+		BlockScanner getScanner(JSONStructuralIndex::Kernel kernel) {
+			switch(kernel) {
+#ifdef JSON_UTIL_X86
+				case JSONStructuralIndex::AVX2:
+					return scanBlockAVX2;
+
+				case JSONStructuralIndex::SSE42:
+					return scanBlockSSE42;
+#endif
+				default:
+					return scanBlockScalar;
+			}
+		}
+
+		//
+		// prefixXor (uint64_t) -> uint64_t
+		//
+		// Bit i of the result is the xor of bits 0..i, which turns quote positions
+		// into a mask of everything from an opening quote up to its closing quote
+		//
+		inline uint64_t prefixXor(uint64_t bits) {
+			bits ^= bits << 1;
+			bits ^= bits << 2;
+			bits ^= bits << 4;
+			bits ^= bits << 8;
+			bits ^= bits << 16;
+			bits ^= bits << 32;
+			return bits;
+		}
+
+		//
+		// findEscaped (uint64_t, uint64_t&) -> uint64_t
+		//
+		// Mark the characters that follow an odd length run of backslashes,
+		// carrying whether the first character of the next block is escaped
+		//
+		inline uint64_t findEscaped(uint64_t backslash, uint64_t& escapedCarry) {
+			constexpr uint64_t EVEN_BITS = 0x5555555555555555ULL;
+
+			backslash &= ~escapedCarry;
+			const uint64_t followsEscape = (backslash << 1) | escapedCarry;
+			const uint64_t oddSequenceStarts = backslash & ~EVEN_BITS & ~followsEscape;
+
+			uint64_t sequencesStartingOnEvenBits;
+			escapedCarry = __builtin_add_overflow(
+					oddSequenceStarts, backslash, &sequencesStartingOnEvenBits) ? 1 : 0;
+
+			const uint64_t invertMask = sequencesStartingOnEvenBits << 1;
+			return (EVEN_BITS ^ invertMask) & followsEscape;
+		}
+	}
+
+	//
+	// Default Constructor
+	//
+	JSONStructuralIndex::JSONStructuralIndex() :
+			valid(false) {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONStructuralIndex::JSONStructuralIndex(std::string_view text) :
+			valid(false) {
+		this->build(text);
+	}
+
+	//
+	// build (std::string_view) -> bool
+	//
+	bool JSONStructuralIndex::build(std::string_view text) {
+		return this->build(text, JSONStructuralIndex::getKernel());
+	}
+
+	//
+	// build (std::string_view, Kernel) -> bool
+	//
+	bool JSONStructuralIndex::build(std::string_view text, Kernel kernel) {
+		this->valid = false;
+		this->positions.clear();
+
+		// Offsets are stored as 32 bits
+		if(text.size() > std::numeric_limits<uint32_t>::max())
+			return false;
+
+		const BlockScanner scan = getScanner(JSONStructuralIndex::isSupported(kernel) ? kernel : SCALAR);
+
+		// State carried between blocks
+		uint64_t escapedCarry = 0, inStringCarry = 0, scalarCarry = 0, singleQuotes = 0;
+
+		// Number of positions written, the vector is grown ahead of the writes
+		std::size_t count = 0;
+
+		// The final partial block is padded with whitespace
+		char tail[BLOCK_SIZE];
+
+		for(std::size_t base = 0; base < text.size(); base += BLOCK_SIZE) {
+			const char* block = text.data() + base;
+			if(text.size() - base < BLOCK_SIZE) {
+				std::memset(tail, ' ', BLOCK_SIZE);
+				std::memcpy(tail, block, text.size() - base);
+				block = tail;
+			}
+
+			BlockMasks m;
+			scan(block, m);
+
+			// Find the quotes that open or close strings, and what lies inside of them
+			const uint64_t quote = m.quote & ~findEscaped(m.backslash, escapedCarry);
+			const uint64_t inString = prefixXor(quote) ^ inStringCarry;
+			inStringCarry = static_cast<uint64_t>(static_cast<int64_t>(inString) >> 63);
+			const uint64_t outside = ~(inString | quote);
+
+			// Structural characters and the first character of bare values
+			const uint64_t op = m.op & outside;
+			const uint64_t scalar = outside & ~(m.op | m.whitespace);
+			const uint64_t scalarStart = scalar & ~((scalar << 1) | scalarCarry);
+			scalarCarry = scalar >> 63;
+			singleQuotes |= m.singleQuote & outside;
+
+			// Write out the positions of every bit set
+			if(this->positions.size() < count + BLOCK_SIZE)
+				this->positions.resize(std::max(this->positions.size() * 2, count + BLOCK_SIZE));
+
+			uint64_t bits = op | quote | scalarStart;
+			while(bits != 0) {
+				this->positions[count++] = static_cast<uint32_t>(base + __builtin_ctzll(bits));
+				bits &= bits - 1;
+			}
+		}
+		this->positions.resize(count);
+
+		// An unterminated string, or strings quoted with ' are left to the parser
+		this->valid = (inStringCarry == 0 && singleQuotes == 0);
+		return this->valid;
+	}
+
+	//
+	// getKernel () -> Kernel
+	//
+	JSONStructuralIndex::Kernel JSONStructuralIndex::getKernel() {
+		static const Kernel kernel = []() {
+			for(Kernel best : {AVX2, SSE42}) {
+				if(JSONStructuralIndex::isSupported(best))
+					return best;
+			}
+			return SCALAR;
+		}();
+		return kernel;
+	}
+
+	//
+	// isSupported (Kernel) -> bool
+	//
+	bool JSONStructuralIndex::isSupported(Kernel kernel) {
+#ifdef JSON_UTIL_X86
+		__builtin_cpu_init();
+		if(kernel == AVX2)
+			return __builtin_cpu_supports("avx2");
+		if(kernel == SSE42)
+			return __builtin_cpu_supports("sse4.2");
+#endif
+		return kernel == SCALAR;
+	}
+
+	//
+	// scanBlock (const char*, Kernel, BlockMasks&) -> void
+	//
+	void JSONStructuralIndex::scanBlock(const char* block, Kernel kernel, BlockMasks& masks) {
+		getScanner(JSONStructuralIndex::isSupported(kernel) ? kernel : SCALAR)(block, masks);
+	}
+
+	//
+	// Destructor
+	//
+	JSONStructuralIndex::~JSONStructuralIndex() {
+
+	}
+}
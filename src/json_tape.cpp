@@ -0,0 +1,497 @@
+/**
+ *  @file		json_tape.cpp
+ *  @brief	  Write documents onto a tape and read them back
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "json_tape.h"
+
+namespace json {
+	//
+	// getType () -> char
+	//
+	char JSONTapeValue::getType() const {
+		if(this->tape == nullptr || this->index >= this->tape->getWords().size())
+			throw JSONException("Json tape value refers to nothing");
+		return this->tape->getType(this->index);
+	}
+
+	//
+	// getBool () -> bool
+	//
+	bool JSONTapeValue::getBool() const {
+		if(!this->isBool())
+			throw JSONException("Json tape value is not a boolean");
+		return this->getType() == 't';
+	}
+
+	//
+	// getInt64 () -> int64_t
+	//
+	int64_t JSONTapeValue::getInt64() const {
+		if(!this->isInteger())
+			throw JSONException("Json tape value is not an int64_t");
+
+		const uint64_t bits = this->tape->getWords()[this->index + 1];
+		if(this->getType() == 'u' && bits > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+			throw JSONException("Json tape value is not an int64_t");
+		return static_cast<int64_t>(bits);
+	}
+
+	//
+	// getUint64 () -> uint64_t
+	//
+	uint64_t JSONTapeValue::getUint64() const {
+		if(!this->isInteger())
+			throw JSONException("Json tape value is not a uint64_t");
+
+		const uint64_t bits = this->tape->getWords()[this->index + 1];
+		if(this->getType() == 'l' && static_cast<int64_t>(bits) < 0)
+			throw JSONException("Json tape value is not a uint64_t");
+		return bits;
+	}
+
+	//
+	// getDouble () -> double
+	//
+	double JSONTapeValue::getDouble() const {
+		if(!this->isNumber())
+			throw JSONException("Json tape value is not a number");
+
+		const uint64_t bits = this->tape->getWords()[this->index + 1];
+		switch(this->getType()) {
+			case 'l':
+				return static_cast<double>(static_cast<int64_t>(bits));
+			case 'u':
+				return static_cast<double>(bits);
+			default: {
+				double value;
+				std::memcpy(&value, &bits, sizeof(value));
+				return value;
+			}
+		}
+	}
+
+	//
+	// getString () -> std::string_view
+	//
+	std::string_view JSONTapeValue::getString() const {
+		this->expectType('"', "a string");
+		return this->tape->getString(this->tape->getPayload(this->index));
+	}
+
+	//
+	// getObject () -> JSONTapeObject
+	//
+	JSONTapeObject JSONTapeValue::getObject() const {
+		this->expectType('{', "an object");
+		return JSONTapeObject(this->tape, this->index);
+	}
+
+	//
+	// getArray () -> JSONTapeArray
+	//
+	JSONTapeArray JSONTapeValue::getArray() const {
+		this->expectType('[', "an array");
+		return JSONTapeArray(this->tape, this->index);
+	}
+
+	//
+	// size () -> std::size_t
+	//
+	std::size_t JSONTapeValue::size() const {
+		if(!this->isObject() && !this->isArray())
+			throw JSONException("Json tape value is not an object or array");
+
+		// Only very large containers have to be counted
+		const uint64_t count = this->tape->getPayload(this->index) >> 32;
+		if(count < JSONTape::MAX_COUNT)
+			return count;
+
+		if(this->isObject()) {
+			JSONTapeObject object = this->getObject();
+			return std::distance(object.begin(), object.end());
+		}
+		JSONTapeArray array = this->getArray();
+		return std::distance(array.begin(), array.end());
+	}
+
+	//
+	// operator[] (std::string_view) -> JSONTapeValue
+	//
+	JSONTapeValue JSONTapeValue::operator[](std::string_view key) const {
+		for(const JSONTapeMember& member : this->getObject()) {
+			if(member.first == key)
+				return member.second;
+		}
+		throw JSONException("No json member with the key: " + std::string(key));
+	}
+
+	//
+	// operator[] (std::size_t) -> JSONTapeValue
+	//
+	JSONTapeValue JSONTapeValue::operator[](std::size_t position) const {
+		std::size_t current = 0;
+		for(const JSONTapeValue& element : this->getArray()) {
+			if(current++ == position)
+				return element;
+		}
+		throw JSONException("No json element at the position: " + std::to_string(position));
+	}
+
+	//
+	// getNext () -> std::size_t
+	//
+	std::size_t JSONTapeValue::getNext() const {
+		switch(this->getType()) {
+			// Containers jump past their closing word
+			case '{': case '[':
+				return (this->tape->getPayload(this->index) & 0xFFFFFFFF) + 1;
+
+			// Numbers take a second word
+			case 'l': case 'u': case 'd':
+				return this->index + 2;
+
+			default:
+				return this->index + 1;
+		}
+	}
+
+	//
+	// toJSONValue () -> JSONValue
+	//
+	JSONValue JSONTapeValue::toJSONValue() const {
+		switch(this->getType()) {
+			case '{': {
+				JSONObject object;
+				for(const JSONTapeMember& member : this->getObject())
+					object.emplace(member.first, member.second.toJSONValue());
+				return object;
+			}
+			case '[': {
+				JSONArray array;
+				for(const JSONTapeValue& element : this->getArray())
+					array.push_back(element.toJSONValue());
+				return array;
+			}
+			case '"':
+				return std::string(this->getString());
+			case 'l': {
+				const int64_t value = this->getInt64();
+				if(value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())
+					return static_cast<int>(value);
+				return value;
+			}
+			case 'u':
+				return this->getUint64();
+			case 'd':
+				return this->getDouble();
+			case 't': case 'f':
+				return this->getBool();
+			default:
+				return std::monostate();
+		}
+	}
+
+	//
+	// expectType (char, const char*) -> void
+	//
+	void JSONTapeValue::expectType(char type, const char* name) const {
+		if(this->getType() != type)
+			throw JSONException(std::string("Json tape value is not ") + name);
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONTapeObject::const_iterator::const_iterator(const JSONTape* tape, std::size_t index) :
+			tape(tape),
+			index(index) {
+		// The closing word has no member to read
+		if(tape->getType(index) == '"') {
+			this->member.first = tape->getString(tape->getPayload(index));
+			this->member.second = JSONTapeValue(tape, index + 1);
+		}
+	}
+
+	//
+	// operator++ () -> const_iterator&
+	//
+	JSONTapeObject::const_iterator& JSONTapeObject::const_iterator::operator++() {
+		*this = const_iterator(this->tape, this->member.second.getNext());
+		return *this;
+	}
+
+	//
+	// begin () -> const_iterator
+	//
+	JSONTapeObject::const_iterator JSONTapeObject::begin() const {
+		return const_iterator(this->tape, this->index + 1);
+	}
+
+	//
+	// end () -> const_iterator
+	//
+	JSONTapeObject::const_iterator JSONTapeObject::end() const {
+		return const_iterator(this->tape, this->tape->getPayload(this->index) & 0xFFFFFFFF);
+	}
+
+	//
+	// begin () -> const_iterator
+	//
+	JSONTapeArray::const_iterator JSONTapeArray::begin() const {
+		return const_iterator(this->tape, this->index + 1);
+	}
+
+	//
+	// end () -> const_iterator
+	//
+	JSONTapeArray::const_iterator JSONTapeArray::end() const {
+		return const_iterator(this->tape, this->tape->getPayload(this->index) & 0xFFFFFFFF);
+	}
+
+	//
+	// Default Constructor
+	//
+	JSONTape::JSONTape() {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONTape::JSONTape(std::vector<uint64_t>&& words, std::string&& strings) :
+			words(std::move(words)),
+			strings(std::move(strings)) {
+
+	}
+
+	//
+	// getString (std::size_t) -> std::string_view
+	//
+	std::string_view JSONTape::getString(std::size_t offset) const {
+		uint32_t length;
+		std::memcpy(&length, this->strings.data() + offset, sizeof(length));
+		return std::string_view(this->strings.data() + offset + sizeof(length), length);
+	}
+
+	//
+	// Destructor
+	//
+	JSONTape::~JSONTape() {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONTapeBuilder::JSONTapeBuilder(std::size_t textLength) :
+			complete(false) {
+		// Most documents take fewer than one word for every three characters, and
+		// every string is at least as long in the text as in the buffer
+		this->words.reserve(textLength / 3 + 2);
+		this->strings.reserve(textLength + 8);
+	}
+
+	//
+	// onStartObject () -> void
+	//
+	void JSONTapeBuilder::onStartObject() {
+		this->start('{');
+	}
+
+	//
+	// onKey (std::string_view) -> void
+	//
+	void JSONTapeBuilder::onKey(std::string_view key) {
+		this->writeString(key);
+	}
+
+	//
+	// onEndObject () -> void
+	//
+	void JSONTapeBuilder::onEndObject() {
+		this->end('}');
+	}
+
+	//
+	// onStartArray () -> void
+	//
+	void JSONTapeBuilder::onStartArray() {
+		this->start('[');
+	}
+
+	//
+	// onEndArray () -> void
+	//
+	void JSONTapeBuilder::onEndArray() {
+		this->end(']');
+	}
+
+	//
+	// onInt (int) -> void
+	//
+	void JSONTapeBuilder::onInt(int value) {
+		this->onInt64(value);
+	}
+
+	//
+	// onInt64 (int64_t) -> void
+	//
+	void JSONTapeBuilder::onInt64(int64_t value) {
+		this->words.push_back(JSONTape::makeWord('l', 0));
+		this->words.push_back(static_cast<uint64_t>(value));
+		this->added();
+	}
+
+	//
+	// onUint64 (uint64_t) -> void
+	//
+	void JSONTapeBuilder::onUint64(uint64_t value) {
+		this->words.push_back(JSONTape::makeWord('u', 0));
+		this->words.push_back(value);
+		this->added();
+	}
+
+	//
+	// onDouble (double) -> void
+	//
+	void JSONTapeBuilder::onDouble(double value) {
+		uint64_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		this->words.push_back(JSONTape::makeWord('d', 0));
+		this->words.push_back(bits);
+		this->added();
+	}
+
+	//
+	// onString (std::string_view) -> void
+	//
+	void JSONTapeBuilder::onString(std::string_view value) {
+		this->writeString(value);
+		this->added();
+	}
+
+	//
+	// onBool (bool) -> void
+	//
+	void JSONTapeBuilder::onBool(bool value) {
+		this->words.push_back(JSONTape::makeWord(value ? 't' : 'f', 0));
+		this->added();
+	}
+
+	//
+	// onNull () -> void
+	//
+	void JSONTapeBuilder::onNull() {
+		this->words.push_back(JSONTape::makeWord('n', 0));
+		this->added();
+	}
+
+	//
+	// takeTape () -> JSONTape
+	//
+	JSONTape JSONTapeBuilder::takeTape() {
+		JSONTape tape(std::move(this->words), std::move(this->strings));
+		this->words.clear();
+		this->strings.clear();
+		this->open.clear();
+		this->complete = false;
+		return tape;
+	}
+
+	//
+	// swapTape (JSONTape&) -> void
+	//
+	void JSONTapeBuilder::swapTape(JSONTape& tape) {
+		tape.swap(this->words, this->strings);
+		this->reset();
+	}
+
+	//
+	// reset () -> void
+	//
+	void JSONTapeBuilder::reset() {
+		this->words.clear();
+		this->strings.clear();
+		this->open.clear();
+		this->complete = false;
+	}
+
+	//
+	// release () -> void
+	//
+	void JSONTapeBuilder::release() {
+		// Clearing keeps the capacity, trading for empty buffers frees it
+		std::vector<uint64_t>().swap(this->words);
+		std::string().swap(this->strings);
+		std::vector<std::pair<std::size_t, uint64_t>>().swap(this->open);
+		this->complete = false;
+	}
+
+	//
+	// added () -> void
+	//
+	void JSONTapeBuilder::added() {
+		if(this->open.empty())
+			this->complete = true;
+		else
+			++this->open.back().second;
+	}
+
+	//
+	// start (char) -> void
+	//
+	void JSONTapeBuilder::start(char type) {
+		// The opening word is filled in once the container ends
+		this->open.emplace_back(this->words.size(), 0);
+		this->words.push_back(JSONTape::makeWord(type, 0));
+	}
+
+	//
+	// end (char) -> void
+	//
+	void JSONTapeBuilder::end(char type) {
+		const std::size_t opening = this->open.back().first;
+		const uint64_t count = std::min<uint64_t>(this->open.back().second, JSONTape::MAX_COUNT);
+		this->open.pop_back();
+
+		// The opening word has 32 bits for the position of the closing one
+		if(this->words.size() > 0xFFFFFFFF)
+			throw JSONException("Json text too large for a tape");
+
+		const char openType = (type == '}') ? '{' : '[';
+		this->words[opening] = JSONTape::makeWord(openType, (count << 32) | this->words.size());
+		this->words.push_back(JSONTape::makeWord(type, opening));
+		this->added();
+	}
+
+	//
+	// writeString (std::string_view) -> void
+	//
+	void JSONTapeBuilder::writeString(std::string_view value) {
+		if(value.size() > std::numeric_limits<uint32_t>::max())
+			throw JSONException("String too long for a json tape");
+
+		const uint32_t length = static_cast<uint32_t>(value.size());
+		this->words.push_back(JSONTape::makeWord('"', this->strings.size()));
+		this->strings.append(reinterpret_cast<const char*>(&length), sizeof(length));
+		this->strings.append(value.data(), value.size());
+	}
+
+	//
+	// Destructor
+	//
+	JSONTapeBuilder::~JSONTapeBuilder() {
+
+	}
+}
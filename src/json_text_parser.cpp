@@ -6,33 +6,31 @@
  *  
  *  @author		Gabriel Shelton	sheltongabe
  *  @date		  07-31-2018
- *  @version	0.4
+ *  @version	0.5
  */
 
 #include "json_text_parser.h"
+#include "json_event_parser.h"
 #include "json_exception.h"
+#include "json_string.h"
+
+#include <algorithm>
+#include <charconv>
+#include <deque>
+#include <future>
+#include <limits>
 
 namespace json {
 	// ----- Initialize static variables used by the methods -----
 
-	// Characters that mark the beginning or termination of a string
-	std::vector<char> JSONTextParser::STRING_MARKERS = {'\'', '\"'};
-
-	// Mark that string reading should be terminated in getString
-	std::vector<char> JSONTextParser::STRING_TERMINATERS = { ',', '}', ']' };
+	// Below this size scanning for the structural index costs more than it saves
+	std::size_t JSONTextParser::STRUCTURAL_INDEX_THRESHOLD = 16 * 1024;
 
-	// Valid boolean strings ordered so if you mod 2 their index you get the 1 or 0 bool value
-	std::vector<std::string> JSONTextParser::BOOLEAN_STRINGS = {
-		"false", "true", "False", "True"
-	};	
+	// Large enough that queueing a batch costs little next to parsing it
+	std::size_t JSONTextParser::LINES_BATCH_SIZE = 256 * 1024;
 
-	// A map between characters that should indicate a recursive call and will perform that call
-	std::map<char, JSONValue(*) (std::stringstream&)> JSONTextParser::RECURSIVE_CHARACTERS = {
-		{ '\'', JSONTextParser::getString },
-		{ '\"', JSONTextParser::getString },
-		{ '{', JSONTextParser::recursiveObjectParser },
-		{ '[', JSONTextParser::recursiveArrayParser }
-	};
+	// Below this size the workers would spend longer starting than parsing
+	std::size_t JSONTextParser::PARALLEL_THRESHOLD = 1024 * 1024;
 
 	//
 	// Default Constructor
@@ -49,198 +47,540 @@ namespace json {
 	}
 
 	//
-	// parse (std::string) -> JSON
+	// parse (std::string_view) -> JSON
+	//
+	JSON JSONTextParser::parse(std::string_view jsonText) {
+		return JSONTextParser::parse(jsonText.data(), jsonText.size());
+	}
+
+	//
+	// parse (const char*, std::size_t) -> JSON
+	//
+	JSON JSONTextParser::parse(const char* jsonText, std::size_t length) {
+		return JSONTextParser::parseObject(std::string_view(jsonText, length), nullptr);
+	}
+
+	//
+	// parse (std::string_view, JSONKeyPool&) -> JSON
+	//
+	JSON JSONTextParser::parse(std::string_view jsonText, JSONKeyPool& keys) {
+		return JSONTextParser::parseObject(jsonText, &keys);
+	}
+
+	//
+	// parseObject (std::string_view, JSONKeyPool*) -> JSON
+	//
+	JSON JSONTextParser::parseObject(std::string_view jsonText, JSONKeyPool* keys) {
+		// Walk the text in place
+		JSONCursor s(jsonText);
+
+		// Index large texts so the cursor can jump from token to token
+		JSONStructuralIndex index;
+		if(jsonText.size() >= JSONTextParser::STRUCTURAL_INDEX_THRESHOLD && index.build(jsonText))
+			s.setIndex(index);
+
+		// Call the recursiveObjectParser and take the built JSON out of the value
+		JSON j = std::get<JSONObject>(JSONTextParser::recursiveObjectParser(s, keys));
+
+		// Only whitespace may follow the object
+		s.skipWhitespace();
+		if(!s.atEnd())
+			s.fail("Unexpected text after the json object");
+
+		return j;
+	}
+
+	//
+	// parseValue (std::string_view) -> JSONValue
+	//
+	JSONValue JSONTextParser::parseValue(std::string_view jsonText) {
+		return JSONTextParser::parseValue(jsonText, nullptr);
+	}
+
+	//
+	// parseValue (std::string_view, JSONKeyPool&) -> JSONValue
+	//
+	JSONValue JSONTextParser::parseValue(std::string_view jsonText, JSONKeyPool& keys) {
+		return JSONTextParser::parseValue(jsonText, &keys);
+	}
+
+	//
+	// parseValue (std::string_view, JSONKeyPool*) -> JSONValue
+	//
+	JSONValue JSONTextParser::parseValue(std::string_view jsonText, JSONKeyPool* keys) {
+		JSONCursor s(jsonText);
+		JSONValue value = JSONTextParser::getValue(s, keys);
+
+		// Only whitespace may follow the value
+		s.skipWhitespace();
+		if(!s.atEnd())
+			s.fail("Unexpected text after the json value");
+
+		return value;
+	}
+
+	//
+	// parseCompactValue (std::string_view) -> JSONCompactValue
+	//
+	JSONCompactValue JSONTextParser::parseCompactValue(std::string_view jsonText) {
+		JSONCompactBuilder builder;
+		JSONEventParser parser(builder);
+		parser.feed(jsonText);
+		parser.finish();
+
+		return builder.takeValue();
+	}
+
+	//
+	// parseTape (std::string_view) -> JSONTape
 	//
-	JSON JSONTextParser::parse(std::string jsonText) {
-		// Build a stream for the jsonText
-		std::stringstream s(jsonText);
+	JSONTape JSONTextParser::parseTape(std::string_view jsonText) {
+		JSONTapeBuilder builder(jsonText.size());
+		JSONEventParser parser(builder);
+		parser.feed(jsonText);
+		parser.finish();
 
-		// Call the recursiveJSONTextParser and return the built JSON project
-		JSON j = std::get<JSONObject>(JSONTextParser::recursiveObjectParser(s));
-		return std::move(j);
+		return builder.takeTape();
 	}
+
+	//
+	// parseParallel (std::string_view, JSONThreadPool&) -> JSON
 	//
-	// recursiveObjectParser (std::stringstream) -> JSON
+	JSON JSONTextParser::parseParallel(std::string_view jsonText, JSONThreadPool& pool) {
+		JSONValue value = JSONTextParser::parseValueParallel(jsonText, pool);
+
+		JSONObject* object = std::get_if<JSONObject>(&value);
+		if(object == nullptr)
+			throw JSONException("Error parsing object in json text at offset 0");
+
+		return std::move(*object);
+	}
+
 	//
-	JSONValue JSONTextParser::recursiveObjectParser(std::stringstream& s) {
+	// parseValueParallel (std::string_view, JSONThreadPool&) -> JSONValue
+	//
+	JSONValue JSONTextParser::parseValueParallel(std::string_view jsonText, JSONThreadPool& pool) {
+		// Find the top level members, anything that cannot be split is left to the serial parser,
+		// which also reports any error in the top level
+		JSONStructuralIndex index;
+		std::vector<std::pair<std::size_t, std::size_t>> members;
+		if(jsonText.size() < JSONTextParser::PARALLEL_THRESHOLD || !index.build(jsonText) ||
+				!JSONTextParser::findMembers(jsonText, index, members))
+			return JSONTextParser::parseValue(jsonText);
+
+		const bool isObject = jsonText[index.getPositions().front()] == '{';
+		const std::size_t numMembers = members.size();
+
+		// Several ranges per worker so an uneven range does not hold up the rest
+		const std::size_t numRanges = std::min(numMembers, 4 * pool.getNumThreads());
+		const std::size_t rangeSize = (numMembers == 0) ? 0 : (numMembers + numRanges - 1) / numRanges;
+
+		// Each range is parsed by its own cursor, which checks the member ends where the scan found
+		auto parseRange = [&](std::size_t first, std::size_t last, auto&& store) {
+			JSONCursor s(jsonText);
+			s.setIndex(index);
+			for(std::size_t i = first; i < last; ++i) {
+				s.moveTo(members[i].first);
+				store(i, s);
+
+				s.skipWhitespace();
+				if(s.offset() != members[i].second)
+					s.fail(isObject ? "Error parsing Object in json text" : "Error parsing array");
+			}
+		};
+
+		std::vector<std::future<void>> results;
+		if(!isObject) {
+			// Elements are parsed straight into their slot
+			JSONArray array;
+			array.resize(numMembers);
+			for(std::size_t first = 0; first < numMembers; first += rangeSize) {
+				const std::size_t last = std::min(first + rangeSize, numMembers);
+				results.push_back(pool.submit([&, first, last]() {
+					parseRange(first, last, [&](std::size_t i, JSONCursor& s) {
+						array[i] = JSONTextParser::getValue(s);
+					});
+				}));
+			}
+			JSONThreadPool::waitAll(results);
+
+			return array;
+		}
+
+		// Members are parsed into pairs, then added to the object in order
+		std::vector<std::pair<std::string, JSONValue>> pairs(numMembers);
+		for(std::size_t first = 0; first < numMembers; first += rangeSize) {
+			const std::size_t last = std::min(first + rangeSize, numMembers);
+			results.push_back(pool.submit([&, first, last]() {
+				parseRange(first, last, [&](std::size_t i, JSONCursor& s) {
+					char starter = s.peek();
+					if(starter != '\"' && starter != '\'')
+						s.fail("Error parsing key of object in json text");
+					pairs[i].first = JSONString::unescape(s.readString());
+
+					s.expect(':', "Error parsing Object in json text");
+					pairs[i].second = JSONTextParser::getValue(s);
+				});
+			}));
+		}
+		JSONThreadPool::waitAll(results);
+
+		JSONObject object;
+		object.reserve(numMembers);
+		for(std::pair<std::string, JSONValue>& member : pairs)
+			object.emplace(std::move(member.first), std::move(member.second));
+
+		return object;
+	}
+
+	//
+	// parseLines (std::string_view, const std::function<void(JSON&)>&, JSONThreadPool&) -> void
+	//
+	void JSONTextParser::parseLines(std::string_view jsonLines,
+			const std::function<void(JSON&)>& onRecord, JSONThreadPool& pool) {
+		// Batches being parsed, oldest first, bounded so a huge file is not all parsed ahead
+		std::deque<std::future<std::vector<JSON>>> batches;
+		const std::size_t maxBatches = 2 * pool.getNumThreads();
+
+		try {
+			std::size_t start = 0;
+			while(start < jsonLines.size() || !batches.empty()) {
+				// Queue batches until the window is full, each ends on a newline
+				while(start < jsonLines.size() && batches.size() < maxBatches) {
+					std::size_t stop = std::min(start + JSONTextParser::LINES_BATCH_SIZE, jsonLines.size());
+					const std::size_t newline = jsonLines.find('\n', stop);
+					stop = (stop == jsonLines.size() || newline == std::string_view::npos) ?
+							jsonLines.size() : newline + 1;
+
+					const std::string_view batch = jsonLines.substr(start, stop - start);
+					batches.push_back(pool.submit([batch]() {
+						return JSONTextParser::parseLineBatch(batch);
+					}));
+					start = stop;
+				}
+
+				// Hand back the oldest batch, keeping the records in order
+				std::vector<JSON> records = batches.front().get();
+				batches.pop_front();
+				for(JSON& record : records)
+					onRecord(record);
+			}
+		}
+		// The batches still queued read the text, let them finish before it can go away
+		catch(...) {
+			for(std::future<std::vector<JSON>>& batch : batches) {
+				if(batch.valid())
+					batch.wait();
+			}
+			throw;
+		}
+	}
+
+	//
+	// findMembers (std::string_view, const JSONStructuralIndex&,
+	// 		std::vector<std::pair<std::size_t, std::size_t>>&) -> bool
+	//
+	bool JSONTextParser::findMembers(std::string_view jsonText, const JSONStructuralIndex& index,
+			std::vector<std::pair<std::size_t, std::size_t>>& members) {
+		const std::vector<uint32_t>& positions = index.getPositions();
+		if(positions.empty())
+			return false;
+
+		const char opener = jsonText[positions.front()];
+		if(opener != '{' && opener != '[')
+			return false;
+		const char closer = (opener == '{') ? '}' : ']';
+
+		// Strings are indexed by their quotes, so only brackets and commas at depth 1 matter
+		const std::size_t none = std::string_view::npos;
+		std::size_t start = none;
+		std::size_t depth = 1;
+		for(std::size_t t = 1; t < positions.size(); ++t) {
+			const std::size_t at = positions[t];
+			const char c = jsonText[at];
+
+			if(depth == 1) {
+				if(c == ',' || c == '}' || c == ']') {
+					// Members cannot be empty, but a trailing comma is allowed like the serial parser
+					if(start != none)
+						members.emplace_back(start, at);
+					else if(c == ',')
+						return false;
+					start = none;
+
+					if(c == ',')
+						continue;
+
+					// The outermost value has to be closed by its own bracket, and be all there is
+					return c == closer && t + 1 == positions.size();
+				}
+
+				if(start == none)
+					start = at;
+			}
+
+			if(c == '{' || c == '[')
+				++depth;
+			else if(c == '}' || c == ']')
+				--depth;
+		}
+
+		// Never closed
+		return false;
+	}
+
+	//
+	// parseLineBatch (std::string_view) -> std::vector<JSON>
+	//
+	std::vector<JSON> JSONTextParser::parseLineBatch(std::string_view batch) {
+		std::vector<JSON> records;
+		while(!batch.empty()) {
+			const std::size_t newline = batch.find('\n');
+			const std::string_view line = batch.substr(0, newline);
+			batch.remove_prefix(newline == std::string_view::npos ? batch.size() : newline + 1);
+
+			// Blank lines (including a lone '\r') hold no record
+			if(line.find_first_not_of(" \t\r") != std::string_view::npos)
+				records.push_back(JSONTextParser::parse(line));
+		}
+
+		return records;
+	}
+
+	//
+	// recursiveObjectParser (JSONCursor&, JSONKeyPool*) -> JSONValue
+	//
+	JSONValue JSONTextParser::recursiveObjectParser(JSONCursor& s, JSONKeyPool* keys) {
 		// Construct the JSON map for this round in the recursive function
-		JSON j;
+		JSONObject j;
+
+		// Holds a key that had escapes
+		std::string scratch;
 
 		// clear { that signifies the begining of an object
-		if(static_cast<char>(s.peek()) == '{')
-			s.get();
-		// If not, it is not an object, throw an exception
-		else
-			throw JSONException("Error parsing object in json text");
+		s.expect('{', "Error parsing object in json text");
 
 		// Loop until you finish this Object
-		while(s.peek() != '}') {
+		while(s.peekNonSpace() != '}') {
 			// Get the key for this iteration
-			std::string key = std::get<std::string>(getString(s));
+			char starter = s.peek();
+			if(starter != '\"' && starter != '\'')
+				s.fail("Error parsing key of object in json text");
+			std::string_view key = JSONString::unescaped(s.readString(), scratch);
 
 			// Skip the colon marking between the key and value
-			if(static_cast<char>(s.peek()) == ':')
-				s.get();
-			else
-				throw JSONException("Error parsing Object in json text");
+			s.expect(':', "Error parsing Object in json text");
 
-			// The value to pair with the key
-			JSONValue value = JSONTextParser::getValue(s);
-
-			// store value with the key
-			j.emplace(key, value);
+			// store value with the key, shared through the pool if there is one
+			if(keys)
+				j.emplace(keys->intern(key), JSONTextParser::getValue(s, keys));
+			else
+				j.emplace(key, JSONTextParser::getValue(s));
 
-			// If there is a comma after the value, consume it
-			if(s.peek() == ',')
+			// A comma continues the object, otherwise it has to end
+			char next = s.peekNonSpace();
+			if(next == ',')
 				s.get();
+			else if(next != '}')
+				s.fail("Error parsing Object in json text");
 		}
 
 		// Get rid of the '}' marking the end of the object and return the JSON built
-		if(static_cast<char>(s.peek()) == '}')
-			s.get();
-		else
-			throw JSONException("Error parsing json Text");
-
-		// If there is a comma after the object, consume it
-		if(s.peek() == ',')
-			s.get();
-
-		// Return object
-		return std::move(j);
+		s.get();
+		return j;
 	}
 
 	//
-	// recursiveArrayParser (std::stringstream&) -> JSONValue
+	// recursiveArrayParser (JSONCursor&, JSONKeyPool*) -> JSONValue
 	//
-	JSONValue JSONTextParser::recursiveArrayParser(std::stringstream& s) {
+	JSONValue JSONTextParser::recursiveArrayParser(JSONCursor& s, JSONKeyPool* keys) {
 		// Get rid of Array marker
-		if(static_cast<char>(s.peek()) == '[')
-			s.get();
-		else
-			throw JSONException("Error parsing Array");
+		s.expect('[', "Error parsing Array");
 
 		// Array to store in
 		JSONArray array;
 
 		// Loop until array ends
-		while(static_cast<char>(s.peek()) != ']') {
+		while(s.peekNonSpace() != ']') {
 			// Grab the value
-			array.push_back(std::move(JSONTextParser::getValue(s)));
+			array.push_back(JSONTextParser::getValue(s, keys));
 
-			// If there is a comma consume it
-			if(static_cast<char>(s.peek()) == ',')
+			// A comma continues the array, otherwise it has to end
+			char next = s.peekNonSpace();
+			if(next == ',')
 				s.get();
+			else if(next != ']')
+				s.fail("Error parsing array");
 		}
 
 		// get rid of the array end marker
-		if(static_cast<char>(s.peek()) == ']')
-			s.get();
-		else
-			throw JSONException("Error parsing array");
-
-		// Get rid of trailing commas
-		if(static_cast<char>(s.peek()) == ',')
-			s.get();
+		s.get();
+		return array;
+	}
 
-		return std::move(array);
+	//
+	// getString (JSONCursor&) -> JSONValue
+	//
+	JSONValue JSONTextParser::getString(JSONCursor& s) {
+		return JSONString::unescape(s.readString());
 	}
 
 	//
-	// getString (std::stringstream) -> std::string
+	// getValue (JSONCursor&, JSONKeyPool*) -> JSONValue
 	//
-	JSONValue JSONTextParser::getString(std::stringstream& s) {
-		// Input helper variables
-		std::string input;
+	JSONValue JSONTextParser::getValue(JSONCursor& s, JSONKeyPool* keys) {
+		// Dispatch on the first character of the value
+		switch(s.peekNonSpace()) {
+			case '{':
+				return JSONTextParser::recursiveObjectParser(s, keys);
 
-		// If we are reading a string
-		if(JSONTextParser::isIn(static_cast<char>(s.peek()), JSONTextParser::STRING_MARKERS)) {
-			// Read until the next char is the flag again
-			char flag = s.get(), tmp;
-			while( (tmp = s.get()) != flag) {
-				input += tmp;
-			}
-		}
-		// If we are reading until a string terminator (reading non-string values)
-		else {
-			char tmp;
-			while(!JSONTextParser::isIn( (tmp = s.get() ), JSONTextParser::STRING_TERMINATERS)) {
-				input += tmp;
-			}
-			s.unget();
-		}
+			case '[':
+				return JSONTextParser::recursiveArrayParser(s, keys);
 
-		// return the input
-		return std::move(input);
+			case '\"':
+			case '\'':
+				return JSONTextParser::getString(s);
+
+			case '\0':
+				s.fail("Unexpected end of json text");
+
+			default:
+				return JSONTextParser::getBaseValue(s);
+		}
 	}
 
 	//
-	// getValue (std::stringstream) -> JSONValue
+	// getBaseValue (JSONCursor&) -> JSONValue
 	//
-	JSONValue JSONTextParser::getValue(std::stringstream& s) {
-		// Value to store to
-		JSONValue value;
+	JSONValue JSONTextParser::getBaseValue(JSONCursor& s) {
+		// Read the bare token that makes up the value
+		const std::size_t start = s.offset();
+		std::string_view v = s.readToken();
 
-		// Peek the next character to see if you need to call a function
-		char starter = s.peek();
-		if(JSONTextParser::RECURSIVE_CHARACTERS.count(starter)) {
-			value = RECURSIVE_CHARACTERS[starter](s);
+		try {
+			return JSONTextParser::convertBaseValue(v);
 		}
-		// The value is not one that is built by another function
-		else {
-			// Get the value non-recursively
-			value = JSONTextParser::getBaseValue(s);
+		catch(JSONException&) {
+			throw JSONException("Error parsing value in json text at offset " +
+					std::to_string(start));
 		}
-
-		return std::move(value);
 	}
 
 	//
-	// getBaseValue (std::stringstream&) -> JSONValue
+	// convertBaseValue (std::string_view) -> JSONValue
 	//
-	JSONValue JSONTextParser::getBaseValue(std::stringstream& s) {
-		// Read everything after the colon into a string and start conversions
-		std::string v = std::get<std::string>(getString(s));
-
-		// Value to return
-		JSONValue value;
+	JSONValue JSONTextParser::convertBaseValue(std::string_view v) {
+		if(v.empty())
+			throw JSONException("Error parsing value in json text");
 
 		// -----Convert v -> value-----
-		// Check if it is a boolean
-		if(JSONTextParser::isIn(v, JSONTextParser::BOOLEAN_STRINGS)) {
-			// Find the index
-			int index = 0;
-			for(int i = 0; i < BOOLEAN_STRINGS.size(); ++i) {
-				if(BOOLEAN_STRINGS[i] == v)
-					index = i;
-			}
-
-			// calculate and store value
-			value = (index % 2 == 0) ? false : true;
+		switch(v.front()) {
+			// Booleans, both the json and capitalized spellings are accepted
+			case 't': case 'T':
+				if(v == "true" || v == "True")
+					return true;
+				break;
+
+			case 'f': case 'F':
+				if(v == "false" || v == "False")
+					return false;
+				break;
+
+			// null
+			case 'n':
+				if(v == "null")
+					return std::monostate();
+				break;
+
+			// Numbers
+			default:
+				return JSONTextParser::convertNumber(v);
 		}
-		// Check for it being null
-		else if(v.find("null") != std::string::npos) {
-			value = std::monostate();
-		}
-		// Check for it being a double
-		else if(v.find('.') != std::string::npos) {
-			value = std::stod(v);
+
+		throw JSONException("Error parsing value in json text");
+	}
+
+	//
+	// isNumber (std::string_view, bool&, bool&) -> bool
+	//
+	bool JSONTextParser::isNumber(std::string_view v, bool& isFloat, bool& negativeExponent) {
+		const char* c = v.data();
+		const char* end = c + v.size();
+
+		// Follow the grammar: -? (0 | [1-9][0-9]*) (. [0-9]+)? ([eE] [+-]? [0-9]+)?
+		auto isDigit = [](const char* at, const char* end) {
+			return at < end && *at >= '0' && *at <= '9';
+		};
+
+		if(c < end && *c == '-')
+			++c;
+		if(!isDigit(c, end))
+			return false;
+		if(*c == '0')
+			++c;
+		else
+			while(isDigit(c, end))
+				++c;
+
+		if(c < end && *c == '.') {
+			isFloat = true;
+			if(!isDigit(++c, end))
+				return false;
+			while(isDigit(c, end))
+				++c;
 		}
-		else {
-			// Assume the type of integer
-			value = std::stoi(v);
+
+		if(c < end && (*c == 'e' || *c == 'E')) {
+			isFloat = true;
+			++c;
+			if(c < end && (*c == '+' || *c == '-'))
+				negativeExponent = (*c++ == '-');
+			if(!isDigit(c, end))
+				return false;
+			while(isDigit(c, end))
+				++c;
 		}
 
-		return std::move(value);
+		return c == end;
 	}
 
 	//
-	// isIn (T, std::vector<T>) -> bool
+	// convertNumber (std::string_view) -> JSONValue
 	//
-	template<typename T>
-	bool JSONTextParser::isIn(T value, std::vector<T> container) {
-		// Set iterators to the begining and end of the vector
-		auto begin = container.begin(), end = container.end();
-		return std::count(begin, end, value) > 0;
+	JSONValue JSONTextParser::convertNumber(std::string_view v) {
+		const char* begin = v.data();
+		const char* end = begin + v.size();
+
+		bool isFloat = false, negativeExponent = false;
+		if(!JSONTextParser::isNumber(v, isFloat, negativeExponent))
+			throw JSONException("Error parsing number in json text");
+
+		// Integers use the smallest type that holds them
+		if(!isFloat) {
+			int64_t i;
+			if(std::from_chars(begin, end, i).ec == std::errc()) {
+				if(i >= std::numeric_limits<int>::min() && i <= std::numeric_limits<int>::max())
+					return static_cast<int>(i);
+				return i;
+			}
+
+			uint64_t u;
+			if(*begin != '-' && std::from_chars(begin, end, u).ec == std::errc())
+				return u;
+
+			// Too large for any integer, keep it as a double
+		}
+
+		double d;
+		const std::from_chars_result result = std::from_chars(begin, end, d);
+		if(result.ec == std::errc::result_out_of_range) {
+			// Numbers too small to represent are 0, too large are an error
+			if(!negativeExponent)
+				throw JSONException("Number is out of range in json text");
+			return (*begin == '-') ? -0.0 : 0.0;
+		}
+
+		return d;
 	}
 
 	//
@@ -0,0 +1,95 @@
+/**
+ *  @file		json_thread_pool.cpp
+ *  @brief	  Start, feed and stop the worker threads
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-17-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <exception>
+
+#include "json_thread_pool.h"
+
+namespace json {
+	//
+	// Initializing Constructor
+	//
+	JSONThreadPool::JSONThreadPool(std::size_t numThreads) :
+			stopping(false) {
+		if(numThreads == 0)
+			numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		this->workers.reserve(numThreads);
+		for(std::size_t i = 0; i < numThreads; ++i)
+			this->workers.emplace_back(&JSONThreadPool::work, this);
+	}
+
+	//
+	// getShared () -> JSONThreadPool&
+	//
+	JSONThreadPool& JSONThreadPool::getShared() {
+		static JSONThreadPool pool;
+		return pool;
+	}
+
+	//
+	// waitAll (std::vector<std::future<void>>&) -> void
+	//
+	void JSONThreadPool::waitAll(std::vector<std::future<void>>& results) {
+		std::exception_ptr error;
+		for(std::future<void>& result : results) {
+			try {
+				result.get();
+			}
+			catch(...) {
+				if(!error)
+					error = std::current_exception();
+			}
+		}
+
+		if(error)
+			std::rethrow_exception(error);
+	}
+
+	//
+	// work () -> void
+	//
+	void JSONThreadPool::work() {
+		while(true) {
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->ready.wait(lock, [this]() {
+					return this->stopping || !this->tasks.empty();
+				});
+
+				// Only exit once every queued task has been run
+				if(this->tasks.empty())
+					return;
+
+				task = std::move(this->tasks.front());
+				this->tasks.pop();
+			}
+
+			task();
+		}
+	}
+
+	//
+	// Destructor
+	//
+	JSONThreadPool::~JSONThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->stopping = true;
+		}
+		this->ready.notify_all();
+
+		for(std::thread& worker : this->workers)
+			worker.join();
+	}
+}
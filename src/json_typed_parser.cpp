@@ -0,0 +1,36 @@
+/**
+ *  @file		json_typed_parser.cpp
+ *  @brief	  The parts of typed parsing that do not depend on the type
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include "json_typed_parser.h"
+
+namespace json {
+	// Initialize static variables
+	std::size_t JSONTypedParser::STRUCTURAL_INDEX_THRESHOLD = 16 * 1024;
+
+	//
+	// readAny (JSONCursor&) -> JSONValue
+	//
+	JSONValue JSONTypedParser::readAny(JSONCursor& s) {
+		// Find where the value ends, then parse just that text
+		const char* start = s.current;
+		s.skipValue();
+		return JSONTextParser::parseValue(std::string_view(start, s.current - start));
+	}
+
+	//
+	// expectEnd (JSONCursor&) -> void
+	//
+	void JSONTypedParser::expectEnd(JSONCursor& s) {
+		s.skipWhitespace();
+		if(!s.atEnd())
+			s.fail("Unexpected text after the json value");
+	}
+}
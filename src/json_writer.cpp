@@ -0,0 +1,341 @@
+/**
+ *  @file		json_writer.cpp
+ *  @brief	  Append json text for each call, tracking the containers that are open
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <utility>
+
+#include <unistd.h>
+
+#include "json_exception.h"
+#include "json_writer.h"
+
+namespace json {
+	//
+	// write (const char*, std::size_t) -> void
+	//
+	void JSONDescriptorSink::write(const char* data, std::size_t length) {
+		// A write may take only part of the text, or be interrupted by a signal
+		while(length > 0) {
+			const ssize_t written = ::write(this->fd, data, length);
+			if(written < 0) {
+				if(errno == EINTR)
+					continue;
+				throw JSONException(std::string("Error writing json text: ") + std::strerror(errno));
+			}
+			data += written;
+			length -= written;
+		}
+	}
+
+	//
+	// writePieces (const std::string_view*, std::size_t) -> void
+	//
+	void JSONDescriptorSink::writePieces(const std::string_view* pieces, std::size_t count) {
+		std::vector<iovec> vectors;
+		vectors.reserve(count);
+		for(std::size_t i = 0; i < count; ++i) {
+			if(!pieces[i].empty())
+				vectors.push_back({const_cast<char*>(pieces[i].data()), pieces[i].size()});
+		}
+
+		// writev takes at most IOV_MAX pieces at once, and may write only part of them
+		std::size_t next = 0;
+		while(next < vectors.size()) {
+			const int batch = static_cast<int>(std::min<std::size_t>(vectors.size() - next, IOV_MAX));
+			ssize_t written = this->writeVectors(vectors.data() + next, batch);
+			if(written < 0) {
+				if(errno == EINTR)
+					continue;
+				throw JSONException(std::string("Error writing json text: ") + std::strerror(errno));
+			}
+
+			// Step past the pieces written in whole, into the one written in part
+			while(next < vectors.size() && static_cast<std::size_t>(written) >= vectors[next].iov_len) {
+				written -= vectors[next].iov_len;
+				++next;
+			}
+			if(written > 0) {
+				vectors[next].iov_base = static_cast<char*>(vectors[next].iov_base) + written;
+				vectors[next].iov_len -= written;
+			}
+		}
+	}
+
+	//
+	// writeVectors (const iovec*, int) -> ssize_t
+	//
+	ssize_t JSONDescriptorSink::writeVectors(const iovec* vectors, int count) {
+		return ::writev(this->fd, vectors, count);
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONWriter::JSONWriter(bool compact, std::string indent) :
+			JSONSerializer(compact, std::move(indent)), first(true), afterKey(false) {
+
+	}
+
+	//
+	// Initializing Constructor
+	//
+	JSONWriter::JSONWriter(JSONSink& sink, bool compact, std::string indent) :
+			JSONSerializer(sink, compact, std::move(indent)), first(true), afterKey(false) {
+
+	}
+
+	//
+	// beginObject () -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::beginObject() {
+		this->beginValue();
+		this->buffer += '{';
+		this->containers.push_back('{');
+		this->first = true;
+		return *this;
+	}
+
+	//
+	// endObject () -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::endObject() {
+#ifndef NDEBUG
+		if(this->afterKey)
+			throw JSONException("Object ended after a key with no value");
+#endif
+		this->end('{', '}');
+		return *this;
+	}
+
+	//
+	// beginArray () -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::beginArray() {
+		this->beginValue();
+		this->buffer += '[';
+		this->containers.push_back('[');
+		this->first = true;
+		return *this;
+	}
+
+	//
+	// endArray () -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::endArray() {
+		this->end('[', ']');
+		return *this;
+	}
+
+	//
+	// key (std::string_view) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::key(std::string_view name) {
+#ifndef NDEBUG
+		if(this->containers.empty() || this->containers.back() != '{')
+			throw JSONException("Key written outside of an object: " + std::string(name));
+		if(this->afterKey)
+			throw JSONException("Key written where a value was expected: " + std::string(name));
+#endif
+		this->separate();
+		this->writeString(name);
+		this->buffer.append(this->compact ? ":" : " : ");
+		this->afterKey = true;
+		return *this;
+	}
+
+	//
+	// null () -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::null() {
+		this->beginValue();
+		this->buffer.append("null");
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (bool) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(bool item) {
+		this->beginValue();
+		this->buffer.append(item ? "true" : "false");
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (int) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(int item) {
+		return this->value(static_cast<int64_t>(item));
+	}
+
+	//
+	// value (int64_t) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(int64_t item) {
+		char digits[JSONSerializer::DOUBLE_SIZE];
+		const char* end = std::to_chars(digits, digits + sizeof(digits), item).ptr;
+
+		this->beginValue();
+		this->buffer.append(digits, end - digits);
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (uint64_t) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(uint64_t item) {
+		char digits[JSONSerializer::DOUBLE_SIZE];
+		const char* end = std::to_chars(digits, digits + sizeof(digits), item).ptr;
+
+		this->beginValue();
+		this->buffer.append(digits, end - digits);
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (double) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(double item) {
+		char digits[JSONSerializer::DOUBLE_SIZE];
+		const std::size_t length = JSONSerializer::formatDouble(item, digits);
+
+		this->beginValue();
+		this->buffer.append(digits, length);
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (std::string_view) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(std::string_view item) {
+		this->beginValue();
+		this->writeString(item);
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (const JSONValue&) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(const JSONValue& item) {
+		this->beginValue();
+		this->writeValue(item, this->containers.size());
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (const JSON&) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(const JSON& item) {
+		this->beginValue();
+		this->writeObject(item, this->containers.size());
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (const JSONArray&) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(const JSONArray& item) {
+		this->beginValue();
+		this->writeArray(item, this->containers.size());
+		this->endValue();
+		return *this;
+	}
+
+	//
+	// value (const JSONAble&) -> JSONWriter&
+	//
+	JSONWriter& JSONWriter::value(const JSONAble& item) {
+#ifndef NDEBUG
+		const std::size_t depth = this->containers.size();
+		item.writeJSON(*this);
+		if(this->containers.size() != depth)
+			throw JSONException("writeJSON left containers open or closed ones it did not open");
+#else
+		item.writeJSON(*this);
+#endif
+		return *this;
+	}
+
+	//
+	// beginValue () -> void
+	//
+	void JSONWriter::beginValue() {
+		// The text holds one value, first stays false once it is begun until clear
+		if(this->containers.empty()) {
+#ifndef NDEBUG
+			if(!this->first)
+				throw JSONException("Second value written at the top level of the text");
+#endif
+			this->first = false;
+			return;
+		}
+
+		// Members are separated before their key, only elements are separated here
+		if(this->containers.back() == '{') {
+#ifndef NDEBUG
+			if(!this->afterKey)
+				throw JSONException("Value written in an object without a key");
+#endif
+			this->afterKey = false;
+			return;
+		}
+		this->separate();
+	}
+
+	//
+	// separate () -> void
+	//
+	void JSONWriter::separate() {
+		if(!this->first)
+			this->buffer += ',';
+		this->first = false;
+
+		if(!this->compact)
+			this->newline(this->containers.size());
+	}
+
+	//
+	// end (char, char) -> void
+	//
+	void JSONWriter::end(char open, char close) {
+#ifndef NDEBUG
+		if(this->containers.empty() || this->containers.back() != open)
+			throw JSONException(std::string("Closing '") + close + "' does not match an open '" + open + "'");
+#endif
+		this->containers.pop_back();
+
+		// The container is an element or member of the one around it, so that is not empty
+		this->first = false;
+		if(!this->compact)
+			this->newline(this->containers.size());
+		this->buffer += close;
+		this->endValue();
+	}
+
+	//
+	// Destructor
+	//
+	JSONWriter::~JSONWriter() {
+
+	}
+}
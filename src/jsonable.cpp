@@ -10,6 +10,7 @@
  */
 
 #include "jsonable.h"
+#include "json_writer.h"
 
 namespace json {
 	//
@@ -40,6 +41,13 @@ namespace json {
 
 	}
 
+	//
+	// writeJSON (JSONWriter&) -> void
+	//
+	void JSONAble::writeJSON(JSONWriter& writer) const {
+		writer.value(this->getJSON());
+	}
+
 	//
 	// Destructor
 	//
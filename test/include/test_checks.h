@@ -0,0 +1,58 @@
+/**
+ *  @file		test_checks.h
+ *  @brief	  Count and report the checks of a test that failed
+ *
+ * 	The tests that make many small checks report each failure as it happens
+ * 	and end with the number that failed, which is also their exit code
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef TEST_CHECKS_H
+#define TEST_CHECKS_H
+
+#include <functional>
+#include <string>
+
+/**
+ * 	@class		TestChecks
+ * 	@brief		Purely static class that counts the checks that failed
+ *
+ */
+class TestChecks {
+	public:
+		/**
+		 * 	@brief	Count a check, reporting it if it failed
+		 *
+		 * 	@param	bool		If the check passed
+		 * 	@param	const std::string&		What was checked
+		 */
+		static void check(bool passed, const std::string& what);
+
+		/**
+		 * 	@brief	Check if something throws a JSONException
+		 *
+		 * 	@param	const std::function<void()>&		What to run
+		 * 	@return	bool		If it threw a JSONException
+		 */
+		static bool throws(const std::function<void()>& run);
+
+		/// Number of checks that failed so far
+		static int getFailures() {
+			return TestChecks::failures;
+		}
+
+		/**
+		 * 	@brief	Print the number of checks that failed
+		 *
+		 * 	@return	int		The exit code of the test, 0 if none failed
+		 */
+		static int report();
+
+	protected:
+		/// Number of checks that failed
+		static int failures;
+};
+#endif
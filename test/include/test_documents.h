@@ -0,0 +1,54 @@
+/**
+ *  @file		test_documents.h
+ *  @brief	  Build random json text for the tests that compare two ways of reading it
+ *
+ * 	The text mixes every kind of value with uneven whitespace, and strings
+ * 	with escapes, long runs and backslashes that land on either side of
+ * 	the SIMD block edges
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#ifndef TEST_DOCUMENTS_H
+#define TEST_DOCUMENTS_H
+
+#include <random>
+#include <string>
+
+/**
+ * 	@class		TestDocuments
+ * 	@brief		Purely static class that generates random json text
+ *
+ */
+class TestDocuments {
+	public:
+		/**
+		 * 	@brief	Generate the text of an object
+		 *
+		 * 	@param	std::mt19937&		The random number generator
+		 * 	@param	int		Number of members of the outermost object
+		 * 	@return	std::string		The text
+		 */
+		static std::string generate(std::mt19937& rng, int numMembers);
+
+		/**
+		 * 	@brief	Generate the text of a string, quotes included
+		 *
+		 * 	@param	std::mt19937&		The random number generator
+		 * 	@param	std::string&		Text the string is appended to
+		 */
+		static void generateString(std::mt19937& rng, std::string& text);
+
+	protected:
+		/// Deepest containers are nested
+		static const int MAX_DEPTH = 4;
+
+		/// Append a random value
+		static void generateValue(std::mt19937& rng, std::string& text, int depth);
+
+		/// Append random whitespace, possibly none
+		static void generateSpace(std::mt19937& rng, std::string& text);
+};
+#endif
@@ -0,0 +1,83 @@
+/**
+ * @file 		json_arena_document_test.cpp
+ * @brief	  Check that an arena document holds the same values as the text parser builds
+ *
+ * 	Each text is parsed into an arena and copied back out with toJSONValue,
+ * 	and compared with what JSONTextParser builds from it.  Members are looked
+ * 	up one by one, documents are read from files, and lookups that can not
+ * 	succeed must throw
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_arena_document.h"
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_file.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_checks.h"
+#include "test_documents.h"
+
+/// Report if two values hold the same
+bool same(const json::JSONValue& left, const json::JSONValue& right) {
+	return std::visit(json::JSONCompare{left}, right);
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(9);
+
+	// Documents and bare values, some with thousands of members
+	std::vector<std::string> texts = {"{}", "[]", "{\"\" : \"\", \"a\" : {\"\" : null}, \"b\" : [[], {}, [[]]]}",
+			"[\"\\ud83d\\ude00\", -0.5e-3, 12345678901234, 18446744073709551615, -9223372036854775808]",
+			"\"\\\\\\\"\\u20ac\"", "-123", "1.5e10", "true", "null"};
+	for(int i = 0; i < 100; ++i)
+		texts.push_back(TestDocuments::generate(rng, 1 + rng() % ((i % 20 == 0) ? 2000 : 30)));
+
+	// ----- Tests -----
+	// The arena holds the same values the text parser builds, and each member is found by its key
+	for(const std::string& text : texts) {
+		const json::JSONArenaDocument document(text);
+		const json::JSONValue expected = json::JSONTextParser::parseValue(text);
+		TestChecks::check(same(expected, json::JSONArenaDocument::toJSONValue(document.getRoot())),
+				"the arena holds the document " + text.substr(0, 100));
+
+		if(text.front() != '{')
+			continue;
+		const json::JSON j = json::JSONTextParser::parse(text);
+		bool found = true;
+		for(const auto& member : j)
+			found = found && same(member.second, json::JSONArenaDocument::toJSONValue(document[member.first.view()]));
+		TestChecks::check(found, "every member is found by its key in " + text.substr(0, 100));
+		TestChecks::check(TestChecks::throws([&document] { document["a key no document has"]; }),
+				"a missing key throws in " + text.substr(0, 100));
+	}
+
+	// Lookups on a root that is not an object throw
+	for(const char* text : {"[1, 2]", "\"a\"", "1", "null", "[{\"a\" : 1}]"}) {
+		const json::JSONArenaDocument document(text);
+		TestChecks::check(TestChecks::throws([&document] { document["a"]; }), std::string("a lookup in the root ") + text);
+	}
+
+	// Broken texts are rejected
+	for(const char* text : {"{\"a\" : \"no close}", "{\"a\" : [1, 2}", "[1, 2", "{\"a\" 1}", "[tru]", "\"\\q\"", "[1] 2", ""})
+		TestChecks::check(TestChecks::throws([text] { json::JSONArenaDocument{text}; }), std::string("rejects ") + text);
+
+	// A document read from a file holds what was written
+	const std::string text = TestDocuments::generate(rng, 500);
+	json::JSONFile::write("arena.json", text);
+	const json::JSONArenaDocument read = json::JSONFile::readArena("arena");
+	TestChecks::check(same(json::JSONTextParser::parseValue(text), json::JSONArenaDocument::toJSONValue(read.getRoot())),
+			"readArena holds the document in the file");
+
+	return TestChecks::report();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file 		json_copy_test.cpp
+ * @brief	  Check that documents are moved or referenced, never deep copied
+ *
+ * 	Every allocation is counted.  A deep copy of the test document allocates for
+ * 	each of its long strings and keys, so an operation allocating a tenth of that
+ * 	cannot have copied the tree
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-17-2026
+ * @version		0.1
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <variant>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_file.h"
+#include "json_util/json_parser.h"
+#include "json_util/json_text_parser.h"
+
+/// Number of allocations made since the program started
+static std::atomic<std::size_t> allocations(0);
+
+void* operator new(std::size_t size) {
+	++allocations;
+	if(void* memory = std::malloc(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+/// Build a document of records with keys and strings too long to be stored inline
+std::string buildRecords(int count) {
+	std::string text = "{\"records\" : [";
+	for(int i = 0; i < count; ++i) {
+		if(i != 0)
+			text += ",";
+		text += "{\"customer_identifier\" : \"customer number " + std::to_string(i) + "\", ";
+		text += "\"shipping_address_line\" : \"" + std::to_string(i) + " Somewhere Street, Some Town\", ";
+		text += "\"items\" : [\"first item in the order\", \"second item in the order\"]}";
+	}
+	text += "]}";
+	return text;
+}
+
+/// Report if the allocations an operation made stay under the limit
+bool check(const std::string& name, std::size_t made, std::size_t limit) {
+	std::cout << name << ": " << made << " allocations (limit " << limit << ")" << std::endl;
+	return made <= limit;
+}
+
+int main(int argc, char **argv) {
+	bool passed = true;
+	std::string text = buildRecords(2000);
+	json::JSON document = json::JSONTextParser::parse(text);
+
+	// A deep copy is what every other operation is measured against
+	std::size_t start = allocations;
+	json::JSON copy(document);
+	std::size_t treeAllocations = allocations - start;
+	std::size_t limit = treeAllocations / 10;
+	std::cout << "deep copy: " << treeAllocations << " allocations" << std::endl;
+
+	// ----- Tests -----
+	// Serializing reads the tree in place
+	start = allocations;
+	std::string pretty = json::JSONParser::parse(document);
+	passed &= check("parse", allocations - start, limit);
+
+	start = allocations;
+	std::string compact = json::JSONParser::parseCompact(document);
+	passed &= check("parseCompact", allocations - start, limit);
+
+	// Writing hands the document and its text along by reference and move
+	start = allocations;
+	json::JSONFile::writeJSON("copy.json", document);
+	passed &= check("writeJSON", allocations - start, limit);
+
+	// Reading parses straight out of the file, the same as parsing the text
+	start = allocations;
+	json::JSON expected = json::JSONTextParser::parse(pretty);
+	std::size_t parseAllocations = allocations - start;
+
+	start = allocations;
+	json::JSON read = json::JSONFile::readJSON("copy.json");
+	passed &= check("readJSON", allocations - start, parseAllocations + limit);
+
+	// Comparing looks at both trees in place
+	json::JSONValue left = json::JSONObject(std::move(expected));
+	json::JSONValue right = json::JSONObject(std::move(read));
+	start = allocations;
+	bool equal = std::visit(json::JSONCompare{left}, right);
+	passed &= check("JSONCompare", allocations - start, limit) && equal;
+
+	// Wrapping a tree in a JSONObject or JSONArray takes it
+	start = allocations;
+	json::JSONValue object = json::JSONObject(std::move(copy));
+	passed &= check("JSONObject(JSON&&)", allocations - start, limit);
+
+	std::vector<json::JSONValue> elements = std::get<json::JSONArray>(document["records"]);
+	start = allocations;
+	json::JSONValue array = json::JSONArray(std::move(elements));
+	passed &= check("JSONArray(std::vector&&)", allocations - start, limit);
+
+	std::cout << "round trip equal: " << equal << std::endl;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file 		json_event_parser_test.cpp
+ * @brief	  Check that text fed to the event parser in chunks reads the same as parsed whole
+ *
+ * 	The same documents are fed 1, 2, 3, 7 and 64 characters at a time and in
+ * 	one piece, so every token, escape and surrogate pair is split at every
+ * 	point, and the value built by a JSONBuilder is compared with
+ * 	JSONTextParser::parseValue
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_event_handler.h"
+#include "json_util/json_event_parser.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_documents.h"
+
+/// Feed a text in chunks of a size, and take the value built
+json::JSONValue feedChunks(const std::string& text, std::size_t chunkSize) {
+	json::JSONBuilder builder;
+	json::JSONEventParser parser(builder);
+	for(std::size_t start = 0; start < text.size(); start += chunkSize)
+		parser.feed(text.data() + start, std::min(chunkSize, text.size() - start));
+	parser.finish();
+
+	if(!builder.isComplete())
+		throw json::JSONException("No value was built");
+	return builder.takeValue();
+}
+
+/// Report if a text is rejected in chunks of every size
+bool rejectChunks(const std::string& text) {
+	for(std::size_t chunkSize : {std::size_t(1), std::size_t(2), std::size_t(3), text.size()}) {
+		try {
+			feedChunks(text, chunkSize);
+			return false;
+		}
+		catch(json::JSONException&) {
+		}
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(4);
+	int mismatches = 0;
+
+	// ----- Tests -----
+	// Documents, top level arrays and bare values, split every way
+	std::vector<std::string> texts = {"[]", "{}", "[\"\\ud83d\\ude00\", -0.5e-3, 12345678901234]",
+			"\"\\\\\\\"\\u20ac\"", "-123", "1.5e10", "true", "null"};
+	for(int i = 0; i < 150; ++i)
+		texts.push_back(TestDocuments::generate(rng, 1 + rng() % 30));
+
+	for(const std::string& text : texts) {
+		const json::JSONValue expected = json::JSONTextParser::parseValue(text);
+		for(std::size_t chunkSize : {std::size_t(1), std::size_t(2), std::size_t(3), std::size_t(7),
+				std::size_t(64), text.size()}) {
+			const json::JSONValue fed = feedChunks(text, chunkSize);
+			if(!std::visit(json::JSONCompare{expected}, fed)) {
+				++mismatches;
+				std::cout << "mismatch in chunks of " << chunkSize << ": " << text.substr(0, 200) << std::endl;
+			}
+		}
+	}
+
+	// Broken texts are rejected however they are split
+	int accepted = 0;
+	for(const char* text : {"{\"a\" : \"no close}", "{\"a\" : [1, 2}", "[1, 2", "{\"a\" 1}", "[tru]", "\"\\q\""}) {
+		if(!rejectChunks(text)) {
+			++accepted;
+			std::cout << "accepted: " << text << std::endl;
+		}
+	}
+
+	std::cout << "mismatches: " << mismatches << ", broken texts accepted: " << accepted << std::endl;
+	return (mismatches == 0 && accepted == 0) ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file 		json_lazy_document_test.cpp
+ * @brief	  Check that lookups in a lazy document find the same values the text parser builds
+ *
+ * 	Every member and element of each document is looked up through the lazy
+ * 	document, down to the scalars, and what it materializes is compared with
+ * 	the value JSONTextParser built.  Lookups that lead nowhere must give a
+ * 	value that does not exist, and broken texts, escapes included, must be
+ * 	rejected when the document is made
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_file.h"
+#include "json_util/json_lazy_document.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_checks.h"
+#include "test_documents.h"
+
+/// Report if a lazy value and everything in it, looked up one at a time, holds the same as a value
+bool walk(const json::JSONLazyValue& lazy, const json::JSONValue& value) {
+	if(const json::JSONObject* object = std::get_if<json::JSONObject>(&value)) {
+		if(!lazy.isObject() || lazy.size() != object->size())
+			return false;
+		for(const auto& member : *object) {
+			if(!walk(lazy[member.first.view()], member.second))
+				return false;
+		}
+		return true;
+	}
+
+	if(const json::JSONArray* array = std::get_if<json::JSONArray>(&value)) {
+		if(!lazy.isArray() || lazy.size() != array->size())
+			return false;
+		for(std::size_t i = 0; i < array->size(); ++i) {
+			if(!walk(lazy[i], (*array)[i]))
+				return false;
+		}
+		return !lazy[array->size()].exists();
+	}
+
+	return lazy.exists() && !lazy.isObject() && !lazy.isArray() &&
+			std::visit(json::JSONCompare{value}, lazy.materialize());
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(3);
+
+	// Documents and bare values, some with hundreds of members
+	std::vector<std::string> texts = {"{}", "[]", " { \"\" : \"\", \"a\" : {\"\" : null}, \"b\" : [[], {}, [[]]] } ",
+			"[\"\\ud83d\\ude00\", -0.5e-3, 12345678901234, 18446744073709551615, -9223372036854775808]",
+			"{\"a\\u0062\" : 1, \"ac\" : 2, \"q\\\"\" : [\"}\", \"]\", \"\\\\\"]}", "\"\\\\\\\"\\u20ac\"", "-123", "true", "null"};
+	for(int i = 0; i < 100; ++i)
+		texts.push_back(TestDocuments::generate(rng, 1 + rng() % ((i % 20 == 0) ? 500 : 30)));
+
+	// ----- Tests -----
+	// Every value found by lookups is the one the text parser builds, and the whole document materializes the same
+	for(const std::string& text : texts) {
+		const json::JSONLazyDocument document(text);
+		const json::JSONValue expected = json::JSONTextParser::parseValue(text);
+		TestChecks::check(walk(document.getRoot(), expected), "lookups find every value of " + text.substr(0, 100));
+		TestChecks::check(std::visit(json::JSONCompare{expected}, document.getRoot().materialize()),
+				"the root materializes as " + text.substr(0, 100));
+	}
+
+	// Keys with escapes are found by what they unescape to, the first of repeated keys is found
+	const json::JSONLazyDocument escaped("{\"a\\u0062\" : 1, \"ab\" : 2, \"t\\tab\" : 3, \"r\" : 4, \"r\" : 5}");
+	TestChecks::check(escaped["ab"].get<int>() == 1 && escaped["t\tab"].get<int>() == 3, "keys are unescaped");
+	TestChecks::check(escaped["r"].get<int>() == 4, "the first of repeated keys is found");
+
+	// Lookups that lead nowhere give values that do not exist, which throw only when materialized
+	const json::JSONLazyDocument document("{\"a\" : {\"b\" : [10, 11, {\"c\" : \"d\"}]}, \"n\" : null}");
+	TestChecks::check(document["a"]["b"][2]["c"].get<std::string>() == "d", "a chain of lookups");
+	TestChecks::check(!document["x"].exists() && !document["x"]["y"][0].exists(), "a missing key and lookups past it");
+	TestChecks::check(!document["a"]["b"][3].exists() && !document["a"]["b"][-1].exists(), "an index out of range");
+	TestChecks::check(!document["a"]["b"]["c"].exists() && !document["a"][0].exists(), "a key in an array and an index in an object");
+	TestChecks::check(document["n"].exists() && document["n"].isNull(), "null exists");
+	TestChecks::check(document["a"]["b"].size() == 3 && document["n"].size() == 0, "sizes");
+	TestChecks::check(TestChecks::throws([&document] { document["x"].materialize(); }), "a missing value throws when materialized");
+
+	// Broken texts are rejected when the document is made, escapes too
+	for(const char* text : {"{\"a\" : \"no close}", "{\"a\" : [1, 2}", "[1, 2", "{\"a\" 1}", "[tru]", "[1] 2", "",
+			"\"\\q\"", "[\"\\u12G4\"]", "{\"\\x\" : 1}", "{\"a\" : [\"ok\", \"\\\"]}"})
+		TestChecks::check(TestChecks::throws([text] { json::JSONLazyDocument{text}; }), std::string("rejects ") + text);
+
+	// A document read from a file finds what was written
+	const std::string text = TestDocuments::generate(rng, 200);
+	json::JSONFile::write("lazy.json", text);
+	TestChecks::check(walk(json::JSONFile::readLazy("lazy.json").getRoot(), json::JSONTextParser::parseValue(text)),
+			"readLazy finds every value in the file");
+
+	return TestChecks::report();
+}
@@ -0,0 +1,116 @@
+/**
+ * @file 		json_lines_test.cpp
+ * @brief	  Check that newline delimited json reads back the records written, in order
+ *
+ * 	LINES_BATCH_SIZE is lowered so the lines are cut into many batches parsed
+ * 	on the pool at once.  Records are compared one by one with the ones the
+ * 	text was built from, with blank lines and "\r\n" endings between them, a
+ * 	broken record must throw, and files built with appendLines must read back
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_file.h"
+#include "json_util/json_serializer.h"
+#include "json_util/json_text_parser.h"
+#include "json_util/json_thread_pool.h"
+
+#include "test_checks.h"
+#include "test_documents.h"
+
+/**
+ * 	@class		BatchedParser
+ * 	@brief		Reach the batch size of the text parser
+ *
+ */
+class BatchedParser : public json::JSONTextParser {
+	public:
+		/// Set the number of characters of lines given to a worker at once
+		static void setBatchSize(std::size_t size) {
+			JSONTextParser::LINES_BATCH_SIZE = size;
+		}
+};
+
+/// Report if the records read are the records expected, in the same order
+bool sameRecords(const std::vector<json::JSON>& read, const std::vector<json::JSON>& expected) {
+	if(read.size() != expected.size())
+		return false;
+	for(std::size_t i = 0; i < read.size(); ++i) {
+		if(!std::visit(json::JSONCompare{json::JSONValue(json::JSONObject(expected[i]))},
+				json::JSONValue(json::JSONObject(read[i]))))
+			return false;
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(7);
+	json::JSONThreadPool pool(3);
+	BatchedParser::setBatchSize(200);
+
+	// Records, and lines holding them with blank lines and both line endings between them
+	std::vector<json::JSON> records;
+	std::string lines;
+	for(int i = 0; i < 400; ++i) {
+		records.push_back(json::JSONTextParser::parse(TestDocuments::generate(rng, 1 + rng() % ((i % 50 == 0) ? 200 : 8))));
+		lines += json::JSONSerializer::serialize(records.back(), true) + ((i % 3 == 0) ? "\r\n" : "\n");
+		if(i % 7 == 0)
+			lines += (i % 2 == 0) ? "\n" : " \t\r\n";
+	}
+
+	// ----- Tests -----
+	// Every record is handed back once, in the order of the text, with or without a newline at the end
+	for(const std::string& text : {lines, "\n\n" + lines.substr(0, lines.size() - 1)}) {
+		std::vector<json::JSON> read;
+		json::JSONTextParser::parseLines(text, [&read](json::JSON& record) { read.push_back(std::move(record)); }, pool);
+		TestChecks::check(sameRecords(read, records), "parseLines reads back every record in order");
+	}
+
+	// Lines with nothing but blank lines hold no records
+	std::size_t blankRecords = 0;
+	json::JSONTextParser::parseLines("\n \n\r\n\t\n", [&blankRecords](json::JSON&) { ++blankRecords; }, pool);
+	TestChecks::check(blankRecords == 0, "blank lines hold no records");
+
+	// A broken record throws, the records before its batch come first and in order
+	const std::size_t middle = lines.find('\n', lines.size() / 2) + 1;
+	for(const char* broken : {"{\"a\" : [1, 2}\n", "[1, 2]\n", "{\"a\" : 1} {\"b\" : 2}\n", "{\"a\" : \"\\q\"}\n"}) {
+		std::vector<json::JSON> read;
+		const std::string text = lines.substr(0, middle) + broken + lines.substr(middle);
+		TestChecks::check(TestChecks::throws([&] {
+			json::JSONTextParser::parseLines(text, [&read](json::JSON& record) { read.push_back(std::move(record)); }, pool);
+		}), std::string("a broken record throws: ") + broken);
+		TestChecks::check(read.size() < records.size() && sameRecords(read,
+				std::vector<json::JSON>(records.begin(), records.begin() + read.size())), "records before the broken one are in order");
+	}
+
+	// Records appended to a file, in a few calls, read back in order
+	std::remove("lines.ndjson");
+	json::JSONFile::appendLines("lines", std::vector<json::JSON>(records.begin(), records.begin() + 150));
+	json::JSONFile::appendLine("lines.ndjson", records[150]);
+	json::JSONFile::appendLines("lines.ndjson", std::vector<json::JSON>(records.begin() + 151, records.end()));
+
+	std::vector<json::JSON> read;
+	json::JSONFile::readLines("lines", [&read](json::JSON& record) { read.push_back(std::move(record)); }, pool);
+	TestChecks::check(sameRecords(read, records), "readLines reads back every record appended");
+
+	// A file with a broken line throws
+	std::ofstream("broken.ndjson") << lines.substr(0, middle) << "{\"a\" 1}\n" << lines.substr(middle);
+	TestChecks::check(TestChecks::throws([&pool] {
+		json::JSONFile::readLines("broken.ndjson", [](json::JSON&) { }, pool);
+	}), "readLines throws for a broken line");
+
+	return TestChecks::report();
+}
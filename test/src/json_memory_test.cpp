@@ -0,0 +1,92 @@
+/**
+ * @file 		json_memory_test.cpp
+ * @brief	  Check what JSONMemory adds up for a document and for the parse that built it
+ *
+ * 	The bytes of a small document are added up by hand and compared with
+ * 	measure.  The executable links the library built with TRACK_ALLOCATIONS,
+ * 	so measureParse counts the allocations of a parse, and its peak must hold
+ * 	the document
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <iostream>
+#include <string>
+#include <variant>
+
+// Include JSON headers
+#include "json_util/json_exception.h"
+#include "json_util/json_key.h"
+#include "json_util/json_memory.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_checks.h"
+
+/// Build a document of records with keys and strings too long to be stored inline
+std::string buildRecords(int count) {
+	std::string text = "{\"records\" : [";
+	for(int i = 0; i < count; ++i) {
+		if(i != 0)
+			text += ",";
+		text += "{\"customer_identifier\" : \"customer number " + std::to_string(i) + " of many\", ";
+		text += "\"id\" : " + std::to_string(i) + ", \"scores\" : [1.5, 3000000000, 18446744073709551615, true, null]}";
+	}
+	text += "]}";
+	return text;
+}
+
+int main(int argc, char **argv) {
+	// ----- Tests -----
+	// A document whose bytes can be added up by hand
+	const std::string longKey = "a_key_long_enough_to_get_its_own_block";
+	const std::string longString = "a string much too long to be kept inside the std::string";
+	json::JSONKeyPool pool;
+	const json::JSON j = json::JSONTextParser::parse("{\"" + longKey + "\" : \"" + longString + "\", " +
+			"\"short\" : \"abc\", \"list\" : [1, 2.5, true, null], \"nested\" : {\"" + longKey + "\" : 3000000000}}", pool);
+
+	const json::JSONArray& list = std::get<json::JSONArray>(j.at("list"));
+	const json::JSONObject& nested = std::get<json::JSONObject>(j.at("nested"));
+	const std::string& stored = std::get<std::string>(j.at(longKey));
+	const json::JSONKey& key = j.begin()->first;
+
+	const json::JSONMemoryUsage usage = json::JSONMemory::measure(j);
+	TestChecks::check(key.isShared() && key.data() == nested.begin()->first.data(), "the long keys share a block");
+	TestChecks::check(usage.keyBytes == key.getAllocatedBytes(), "a shared key block is counted once");
+	TestChecks::check(usage.stringBytes == stored.capacity() + 1, "only the long string allocates");
+	TestChecks::check(usage.containerBytes == sizeof(json::JSON) + j.getAllocatedBytes() + nested.getAllocatedBytes() +
+			list.capacity() * sizeof(json::JSONValue), "containers hold the members and elements");
+	TestChecks::check(usage.totalBytes() == usage.keyBytes + usage.stringBytes + usage.containerBytes, "the total is the split");
+
+	TestChecks::check(usage.objects == 2 && usage.arrays == 1 && usage.strings == 2 && usage.ints == 1 &&
+			usage.int64s == 1 && usage.doubles == 1 && usage.bools == 1 && usage.nulls == 1, "values are counted by type");
+	TestChecks::check(usage.totalValues() == 10 && usage.keys == 5 && usage.sharedKeys == 2, "keys are counted");
+
+	// A value is measured without its own size, it lives in whatever holds it
+	const json::JSONMemoryUsage listUsage = json::JSONMemory::measure(j.at("list"));
+	TestChecks::check(listUsage.containerBytes == list.capacity() * sizeof(json::JSONValue) && listUsage.arrays == 1,
+			"a value is measured without its own size");
+
+	// The peak of a parse holds at least the document it leaves, whose root is not allocated
+	TestChecks::check(json::JSONMemory::isTrackingAllocations(), "the test is built to count allocations");
+	const std::string records = buildRecords(2000);
+	const json::JSONParseMemory parsed = json::JSONMemory::measureParse(records);
+	TestChecks::check(parsed.peakBytes >= parsed.document.totalBytes() - sizeof(json::JSON), "the peak holds the document");
+	TestChecks::check(parsed.allocations >= parsed.document.objects - 1 + parsed.document.arrays, "every container is counted");
+	TestChecks::check(parsed.document.objects == 2001 && parsed.document.strings == 2000, "the document is measured");
+
+	// A broken text throws, and the next parse is counted from nothing
+	try {
+		json::JSONMemory::measureParse("{\"a\" : [1, 2}");
+		TestChecks::check(false, "a broken text throws");
+	}
+	catch(json::JSONException&) {
+	}
+	const json::JSONParseMemory small = json::JSONMemory::measureParse("{\"a\" : 1}");
+	TestChecks::check(small.peakBytes < parsed.peakBytes && small.allocations < parsed.allocations, "parses are counted apart");
+
+	std::cout << "peak bytes: " << parsed.peakBytes << ", document bytes: " << parsed.document.totalBytes() <<
+			", allocations: " << parsed.allocations << std::endl;
+	return TestChecks::report();
+}
@@ -0,0 +1,100 @@
+/**
+ * @file 		json_parallel_parse_test.cpp
+ * @brief	  Check that parsing the members of a text in parallel builds the same value as parsing it serially
+ *
+ * 	PARALLEL_THRESHOLD is lowered so every text is split into ranges of
+ * 	members parsed on the pool.  Objects, arrays and bare values are compared
+ * 	with what parseValue builds, member order included, and every text that
+ * 	the serial parser rejects must be rejected in parallel too
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_exception.h"
+#include "json_util/json_file.h"
+#include "json_util/json_serializer.h"
+#include "json_util/json_text_parser.h"
+#include "json_util/json_thread_pool.h"
+
+#include "test_checks.h"
+#include "test_documents.h"
+
+/**
+ * 	@class		ParallelParser
+ * 	@brief		Reach the threshold of the text parser
+ *
+ */
+class ParallelParser : public json::JSONTextParser {
+	public:
+		/// Set the length texts start being parsed in parallel at
+		static void setThreshold(std::size_t threshold) {
+			JSONTextParser::PARALLEL_THRESHOLD = threshold;
+		}
+};
+
+/// Get the text of a value with its members in order, or "rejected" if the parse threw
+std::string describe(const std::function<json::JSONValue()>& parse) {
+	try {
+		const json::JSONValue value = parse();
+		json::JSONSerializer serializer(true);
+		serializer.write(value);
+		return std::string(serializer.getText());
+	}
+	catch(json::JSONException&) {
+		return "rejected";
+	}
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(8);
+	json::JSONThreadPool pool(3);
+	ParallelParser::setThreshold(0);
+
+	// Objects and arrays from empty to thousands of members, bare values, and whitespace around them
+	std::vector<std::string> texts = {"{}", "[]", " { } ", "[1]", "{\"a\" : 1}", "\"a\"", "12", "null",
+			"{\"a\" : 1, \"b\" : [1, {\"c\" : \"}]\"}], \"a\" : 2}", " [ [], {}, \"\\\"[\", -1.5e3 ]\n"};
+	for(int i = 0; i < 100; ++i) {
+		const std::string object = TestDocuments::generate(rng, 1 + rng() % ((i % 10 == 0) ? 3000 : 40));
+		texts.push_back(object);
+		texts.push_back("[" + object + ", 1, \"x\", " + object + "]");
+	}
+
+	// Broken texts, at the top level and inside one member
+	for(const char* broken : {"{\"a\" : 1,}", "[1, 2,]", "{\"a\" : 1} 2", "[1] [2]", "{\"a\" 1, \"b\" : 2}",
+			"{\"a\" : 1, \"b\" : [1, 2}", "[1, {\"a\" : 1]", "[1, tru, 3]", "{1 : 2}", "[\"\\q\"]", "{\"a\" : 1",
+			"[1, 2", "{\"a\" : 01}", "[1 2]"})
+		texts.push_back(broken);
+
+	// ----- Tests -----
+	// Each text builds the same value, or is rejected the same, in parallel and serially
+	for(const std::string& text : texts) {
+		const std::string serial = describe([&text] { return json::JSONTextParser::parseValue(text); });
+		const std::string parallel = describe([&text, &pool] { return json::JSONTextParser::parseValueParallel(text, pool); });
+		TestChecks::check(parallel == serial, "parseValueParallel matches parseValue for " + text.substr(0, 100) +
+				"\n\tparallel: " + parallel.substr(0, 100) + "\n\tserial:   " + serial.substr(0, 100));
+	}
+
+	// Objects through parseParallel, and read from a file on a pool
+	const std::string text = TestDocuments::generate(rng, 2000);
+	const json::JSON expected = json::JSONTextParser::parse(text);
+	TestChecks::check(json::JSONSerializer::serialize(json::JSONTextParser::parseParallel(text, pool), true) ==
+			json::JSONSerializer::serialize(expected, true), "parseParallel matches parse");
+	TestChecks::check(TestChecks::throws([&pool] { json::JSONTextParser::parseParallel("[1, 2]", pool); }),
+			"parseParallel rejects an array");
+
+	json::JSONFile::write("parallel_parse.json", text);
+	TestChecks::check(json::JSONSerializer::serialize(json::JSONFile::readJSON("parallel_parse.json", pool), true) ==
+			json::JSONSerializer::serialize(expected, true), "readJSON on a pool matches parse");
+
+	return TestChecks::report();
+}
@@ -0,0 +1,151 @@
+/**
+ * @file 		json_parallel_serializer_test.cpp
+ * @brief	  Check that writing in parallel gives the same text as writing serially, and that writev sends all of it
+ *
+ * 	PARALLEL_THRESHOLD and PARALLEL_CHUNK_SIZE are lowered so documents of a
+ * 	few hundred members are split into many chunks.  The descriptor sink's
+ * 	writev is replaced by one that takes only part of the pieces and is
+ * 	sometimes interrupted, so every piece has to be resumed where it stopped
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_file.h"
+#include "json_util/json_serializer.h"
+#include "json_util/json_text_parser.h"
+#include "json_util/json_thread_pool.h"
+#include "json_util/json_writer.h"
+
+#include "test_checks.h"
+#include "test_documents.h"
+
+/// A descriptor sink whose writev takes a few characters at a time, and is interrupted every few calls
+class PartialSink : public json::JSONDescriptorSink {
+	public:
+		PartialSink(int fd, std::size_t most) : json::JSONDescriptorSink(fd), most(most) { }
+
+		/// Most pieces handed to one writev
+		int largestBatch = 0;
+
+		/// Number of calls to writev
+		std::size_t calls = 0;
+
+	protected:
+		/// Most characters taken by one writev
+		std::size_t most;
+
+		ssize_t writeVectors(const iovec* vectors, int count) override {
+			largestBatch = std::max(largestBatch, count);
+			if(++calls % 5 == 0) {
+				errno = EINTR;
+				return -1;
+			}
+
+			// Hand on the pieces up to most characters, the last of them cut short
+			std::vector<iovec> taken;
+			std::size_t left = this->most;
+			for(int i = 0; i < count && left > 0; ++i) {
+				taken.push_back(vectors[i]);
+				taken.back().iov_len = std::min(taken.back().iov_len, left);
+				left -= taken.back().iov_len;
+			}
+			return json::JSONDescriptorSink::writeVectors(taken.data(), static_cast<int>(taken.size()));
+		}
+};
+
+/// Build the text of an array of values from generated objects
+std::string buildArray(std::mt19937& rng, int count) {
+	std::string text = "[";
+	for(int i = 0; i < count; ++i) {
+		if(i != 0)
+			text += ", ";
+		text += (i % 3 == 0) ? std::to_string(i) : TestDocuments::generate(rng, 1 + rng() % 4);
+	}
+	return text + "]";
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(25);
+	json::JSONThreadPool pool(3);
+
+	// Split containers of a few hundred members into chunks of a few members
+	json::JSONSerializer::PARALLEL_THRESHOLD = 16;
+	json::JSONSerializer::PARALLEL_CHUNK_SIZE = 7;
+
+	// ----- Tests -----
+	// Objects and arrays on both sides of the threshold are written the same in parallel, in both layouts
+	for(int members : {0, 1, 15, 16, 17, 100, 700}) {
+		const json::JSON j = json::JSONTextParser::parse(TestDocuments::generate(rng, members));
+		const json::JSONValue array = json::JSONTextParser::parseValue(buildArray(rng, members));
+		const std::string size = " of " + std::to_string(members);
+
+		for(bool compact : {false, true}) {
+			const std::string layout = compact ? ", compact" : ", pretty";
+			TestChecks::check(json::JSONSerializer::serializeParallel(j, compact, pool) ==
+					json::JSONSerializer::serialize(j, compact), "an object" + size + layout);
+
+			json::JSONSerializer serial(compact), parallel(compact);
+			serial.write(array);
+			parallel.writeParallel(array, pool);
+			TestChecks::check(parallel.getText() == serial.getText(), "an array" + size + layout);
+
+			// Through a sink the finished chunks go out together
+			std::ostringstream stream;
+			json::JSONStreamSink sink(stream);
+			json::JSONSerializer streaming(sink, compact);
+			streaming.writeParallel(j, pool);
+			streaming.flush();
+			TestChecks::check(stream.str() == json::JSONSerializer::serialize(j, compact), "an object through a sink" + size + layout);
+		}
+	}
+
+	// More pieces than one writev takes, each cut short, all reach the file in order
+	std::vector<std::string> texts;
+	std::string expected;
+	for(std::size_t i = 0; i < 3 * IOV_MAX + 11; ++i) {
+		texts.push_back((i % 17 == 0) ? std::string() : std::string(1 + rng() % 40, static_cast<char>('a' + i % 26)));
+		expected += texts.back();
+	}
+	const std::vector<std::string_view> pieces(texts.begin(), texts.end());
+
+	for(std::size_t most : {std::size_t(1), std::size_t(37), std::size_t(5000), expected.size()}) {
+		const int fd = ::open("pieces.json", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		PartialSink sink(fd, most);
+		sink.writePieces(pieces.data(), pieces.size());
+		::close(fd);
+
+		const std::string where = " taking " + std::to_string(most) + " at a time";
+		TestChecks::check(json::JSONFile::read("pieces.json") == expected, "every piece is written once, in order" + where);
+		TestChecks::check(sink.largestBatch == IOV_MAX, "the pieces are handed to writev IOV_MAX at a time" + where);
+	}
+
+	// A document written to a file in parallel reads back the same
+	const json::JSON j = json::JSONTextParser::parse(TestDocuments::generate(rng, 2000));
+	json::JSONFile::writeJSON("parallel.json", j, pool);
+	TestChecks::check(json::JSONFile::read("parallel.json") == json::JSONSerializer::serialize(j),
+			"the file holds what serialize writes");
+	TestChecks::check(std::visit(json::JSONCompare{json::JSONValue(json::JSONObject(j))},
+			json::JSONValue(json::JSONObject(json::JSONFile::readJSON("parallel.json")))), "the file reads back the same");
+
+	return TestChecks::report();
+}
@@ -0,0 +1,182 @@
+/**
+ * @file 		json_persistent_document_test.cpp
+ * @brief	  Check that updates to a persistent document leave the old version as it was
+ *
+ * 	Each update is checked for the value it writes, for sharing the members
+ * 	it does not touch with the version it was made from, and for leaving that
+ * 	version equal to the text it was parsed from.  Updates to a root and an
+ * 	array of a hundred thousand members must allocate a few nodes, not a copy
+ * 	of all of them
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_persistent_document.h"
+#include "json_util/json_serializer.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_checks.h"
+
+/// Number of bytes allocated since the program started
+static std::atomic<std::size_t> allocatedBytes(0);
+
+void* operator new(std::size_t size) {
+	allocatedBytes += size;
+	if(void* memory = std::malloc(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+/// Members of the wide root, and elements of the wide array in it
+const std::size_t WIDE = 100000;
+
+/// Most bytes an update of the wide document may allocate, a copy of the root would take megabytes
+const std::size_t MAX_UPDATE_BYTES = 64 * 1024;
+
+/// Bytes allocated while an update runs
+std::size_t measure(const std::function<void()>& update) {
+	const std::size_t before = allocatedBytes;
+	update();
+	return allocatedBytes - before;
+}
+
+/// Report if a document holds the same values as a text
+bool holds(const json::JSONPersistentDocument& document, const std::string& text) {
+	const json::JSONValue expected = json::JSONTextParser::parseValue(text);
+	return std::visit(json::JSONCompare{expected}, document.getRoot().toJSONValue());
+}
+
+int main(int argc, char **argv) {
+	const std::string text = "{\"a\" : {\"x\" : 1, \"y\" : [1, 2, 3]}, \"b\" : [10, 20, 30], \"c\" : \"text\"}";
+	const json::JSONPersistentDocument original(json::JSONTextParser::parse(text));
+	const json::JSONPath x = {"a", "x"};
+	const json::JSONPath y = {"a", "y"};
+	const json::JSONPath b = {"b"};
+
+	// ----- Tests -----
+	// Replacing a nested member copies only the objects on the path
+	const json::JSONPersistentDocument setX = original.set(x, 2);
+	TestChecks::check(std::get<int>(setX.get(x).getScalar()) == 2, "set writes the value");
+	TestChecks::check(setX.get(y).shares(original.get(y)), "set shares the sibling of the member");
+	TestChecks::check(setX["b"].shares(original["b"]), "set shares the members of the root");
+	TestChecks::check(setX["c"].shares(original["c"]), "set shares scalar members");
+	TestChecks::check(!setX["a"].shares(original["a"]), "set copies the object on the path");
+	TestChecks::check(holds(original, text), "set leaves the old version unchanged");
+	TestChecks::check(setX != original, "versions differ after set");
+
+	// Adding a member
+	const json::JSONPersistentDocument added = original.set({"d"}, true);
+	TestChecks::check(std::get<bool>(added["d"].getScalar()), "set adds a member");
+	TestChecks::check(added["a"].shares(original["a"]), "adding shares the other members");
+	TestChecks::check(TestChecks::throws([&] { original["d"]; }), "adding leaves the old version without the member");
+
+	// Erasing a member
+	const json::JSONPersistentDocument erasedX = original.erase(x);
+	TestChecks::check(TestChecks::throws([&] { erasedX.get(x); }), "erase removes the member");
+	TestChecks::check(erasedX.get(y).shares(original.get(y)), "erase shares the sibling of the member");
+	TestChecks::check(std::get<int>(original.get(x).getScalar()) == 1, "erase leaves the old version unchanged");
+
+	// Erasing an element of an array moves the rest down
+	const json::JSONPersistentDocument erasedElement = original.erase({"b", std::size_t(1)});
+	TestChecks::check(holds(erasedElement, "{\"a\" : {\"x\" : 1, \"y\" : [1, 2, 3]}, \"b\" : [10, 30], \"c\" : \"text\"}"),
+			"erase removes the element");
+	TestChecks::check(erasedElement["a"].shares(original["a"]), "erasing an element shares the other members");
+	TestChecks::check(original.get(b).getArray().size() == 3, "erasing an element leaves the old version unchanged");
+
+	// An index one past the end appends, and replacing an element keeps the others
+	const json::JSONPersistentDocument appended = original.set({"b", std::size_t(3)}, 40);
+	TestChecks::check(appended.get(b).getArray().size() == 4 &&
+			std::get<int>(appended.get({"b", std::size_t(3)}).getScalar()) == 40, "set at the size appends");
+	TestChecks::check(original.get(b).getArray().size() == 3, "appending leaves the old version unchanged");
+
+	const json::JSONPersistentDocument replaced = original.set({"a", "y", std::size_t(0)}, "first");
+	TestChecks::check(replaced.get({"a", "y", std::size_t(1)}).shares(original.get({"a", "y", std::size_t(1)})),
+			"replacing an element shares the other elements");
+	TestChecks::check(holds(original, text), "replacing an element leaves the old version unchanged");
+
+	// Snapshots share the whole document
+	const json::JSONPersistentDocument snapshot = setX.snapshot();
+	TestChecks::check(snapshot.getRoot().shares(setX.getRoot()) && snapshot == setX, "snapshots share the root");
+
+	// Paths that lead nowhere throw and leave the document as it was
+	TestChecks::check(TestChecks::throws([&] { original.set({"b", std::size_t(5)}, 1); }), "set past the end of an array");
+	TestChecks::check(TestChecks::throws([&] { original.set({"missing", "x"}, 1); }), "set through a missing member");
+	TestChecks::check(TestChecks::throws([&] { original.set({"c", "x"}, 1); }), "set through a string as an object");
+	TestChecks::check(TestChecks::throws([&] { original.set({"a", std::size_t(0)}, 1); }), "set through an object as an array");
+	TestChecks::check(TestChecks::throws([&] { original.erase({"missing"}); }), "erase a missing member");
+	TestChecks::check(TestChecks::throws([&] { original.erase({"b", std::size_t(3)}); }), "erase one past the end of an array");
+	TestChecks::check(TestChecks::throws([&] { original.erase({}); }), "erase the root");
+	TestChecks::check(TestChecks::throws([&] { original.get({"a", "y", std::size_t(3)}); }), "get past the end of an array");
+	TestChecks::check(TestChecks::throws([&] { original["c"].getObject(); }), "get a string as an object");
+	TestChecks::check(holds(original, text), "failed updates leave the document unchanged");
+
+	// Updates to a wide root and a wide array copy a path through them, not their members
+	json::JSON wideJSON;
+	json::JSONArray elements;
+	for(std::size_t i = 0; i < WIDE; ++i) {
+		wideJSON["member " + std::to_string(i)] = static_cast<int>(i);
+		elements.push_back(static_cast<int>(i));
+	}
+	wideJSON["wide"] = elements;
+	const json::JSONPersistentDocument wide(wideJSON);
+	const json::JSONPath middle = {"member 50000"}, last = {"member 99999"}, element = {"wide", std::size_t(70000)};
+	const json::JSONPath appendedElement = {"wide", WIDE}, newMember = {"new member"};
+	const json::JSONPersistentValue one = 1;
+
+	json::JSONPersistentDocument wideSet, wideAdded, wideErased, wideElement, wideAppended;
+	const std::size_t setBytes = measure([&] { wideSet = wide.set(middle, one); });
+	const std::size_t addBytes = measure([&] { wideAdded = wide.set(newMember, one); });
+	const std::size_t eraseBytes = measure([&] { wideErased = wide.erase(middle); });
+	const std::size_t elementBytes = measure([&] { wideElement = wide.set(element, one); });
+	const std::size_t appendBytes = measure([&] { wideAppended = wide.set(appendedElement, one); });
+	TestChecks::check(setBytes < MAX_UPDATE_BYTES, "setting a member of a wide root allocated " + std::to_string(setBytes));
+	TestChecks::check(addBytes < MAX_UPDATE_BYTES, "adding a member to a wide root allocated " + std::to_string(addBytes));
+	TestChecks::check(eraseBytes < MAX_UPDATE_BYTES, "erasing a member of a wide root allocated " + std::to_string(eraseBytes));
+	TestChecks::check(elementBytes < MAX_UPDATE_BYTES, "setting an element of a wide array allocated " + std::to_string(elementBytes));
+	TestChecks::check(appendBytes < MAX_UPDATE_BYTES, "appending to a wide array allocated " + std::to_string(appendBytes));
+
+	TestChecks::check(wideSet.get(middle).shares(one) && wideSet.get(last).shares(wide.get(last)) &&
+			wideSet["wide"].shares(wide["wide"]), "setting a member of a wide root shares its siblings");
+	TestChecks::check(wideAdded.get(newMember).shares(one) && wideAdded.getRoot().getObject().size() == WIDE + 2,
+			"adding a member to a wide root");
+	TestChecks::check(TestChecks::throws([&] { wideErased.get(middle); }) &&
+			wideErased.getRoot().getObject().size() == WIDE, "erasing a member of a wide root");
+	TestChecks::check(wideElement.get(element).shares(one) && wideElement.get({"wide", std::size_t(69999)}).shares(
+			wide.get({"wide", std::size_t(69999)})), "setting an element of a wide array shares the others");
+	TestChecks::check(wideAppended.get({"wide"}).getArray().size() == WIDE + 1 && wideAppended.get(appendedElement).shares(one),
+			"appending to a wide array");
+	TestChecks::check(std::get<int>(wide.get(middle).getScalar()) == 50000 && wide.getRoot().getObject().size() == WIDE + 1 &&
+			wide.get({"wide"}).getArray().size() == WIDE, "updates leave the wide document unchanged");
+
+	// Members keep their order through updates, and versions that differ in one member compare unequal
+	json::JSON expected = wideJSON;
+	expected["member 50000"] = 1;
+	TestChecks::check(json::JSONSerializer::serialize(wideSet.getRoot(), true) == json::JSONSerializer::serialize(expected, true),
+			"a set wide root holds the members in order");
+	TestChecks::check(wideSet != wide && wideElement != wide && wideSet == json::JSONPersistentDocument(expected),
+			"versions of a wide root compare by value");
+
+	return TestChecks::report();
+}
@@ -0,0 +1,106 @@
+/**
+ * @file 		json_pointer_test.cpp
+ * @brief	  Check how JSON Pointers are read and followed, and that a JSONPathIndex follows changes
+ *
+ * 	Tokens are checked for the '~0' and '~1' escapes and for which of them
+ * 	are array indices.  A JSONPathIndex caches where each pointer led, which
+ * 	moves when members are added or erased, so it is checked after rebuild
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <variant>
+
+// Include JSON headers
+#include "json_util/json_exception.h"
+#include "json_util/json_pointer.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_checks.h"
+
+/// Report if reading a pointer throws a JSONException
+bool throws(const char* pointer) {
+	return TestChecks::throws([pointer] { json::JSONPointer{pointer}; });
+}
+
+/// Get the int a pointer leads to, or -1 if it leads nowhere or to something else
+int intAt(const json::JSON& j, const json::JSONPointer& pointer) {
+	const json::JSONValue* value = pointer.find(j);
+	return (value != nullptr && std::holds_alternative<int>(*value)) ? std::get<int>(*value) : -1;
+}
+
+int main(int argc, char **argv) {
+	json::JSON j = json::JSONTextParser::parse("{\"a/b\" : 1, \"m~n\" : 2, \"~1\" : 3, \"\" : 4, \"-\" : 5, "
+			"\"list\" : [10, 11, 12], \"object\" : {\"0\" : 20, \"01\" : 21, \"-\" : 22}, \"c%d\" : 6}");
+
+	// ----- Tests -----
+	// '~1' is '/' and '~0' is '~', read left to right so '~01' is "~1"
+	TestChecks::check(intAt(j, "/a~1b") == 1, "~1 is a slash");
+	TestChecks::check(intAt(j, "/m~0n") == 2, "~0 is a tilde");
+	TestChecks::check(intAt(j, "/~01") == 3, "~01 is a tilde then 1");
+	TestChecks::check(intAt(j, "/a/b") == -1, "an unescaped slash splits tokens");
+	TestChecks::check(intAt(j, "/") == 4, "an empty token is the empty key");
+	TestChecks::check(intAt(j, "/c%d") == 6, "other characters are taken as written");
+	TestChecks::check(json::JSONPointer("/a~1b").getTokens()[0].key == "a/b", "the token holds the unescaped key");
+
+	// Broken escapes and pointers not starting with '/'
+	TestChecks::check(throws("/a~"), "a tilde at the end is rejected");
+	TestChecks::check(throws("/a~2"), "a tilde before another character is rejected");
+	TestChecks::check(throws("a"), "a pointer must start with a slash");
+	TestChecks::check(!throws(""), "the empty pointer is the root");
+
+	// "-" and numbers with leading zeros are keys, never array indices
+	TestChecks::check(intAt(j, "/list/0") == 10 && intAt(j, "/list/2") == 12, "digits index an array");
+	TestChecks::check(intAt(j, "/list/3") == -1, "an index past the end leads nowhere");
+	TestChecks::check(intAt(j, "/list/-") == -1, "- is past the end of an array");
+	TestChecks::check(intAt(j, "/list/01") == -1 && intAt(j, "/list/00") == -1, "a leading zero is not an index");
+	TestChecks::check(intAt(j, "/-") == 5 && intAt(j, "/object/-") == 22, "- is a key of an object");
+	TestChecks::check(intAt(j, "/object/0") == 20 && intAt(j, "/object/01") == 21, "digits are keys of an object");
+	TestChecks::check(json::JSONPointer("/-").getTokens()[0].index == json::JSONPointer::NO_INDEX &&
+			json::JSONPointer("/01").getTokens()[0].index == json::JSONPointer::NO_INDEX &&
+			json::JSONPointer("/0").getTokens()[0].index == 0, "tokens know which are indices");
+
+	// The root pointer leads to the value it is given, an object has no value for it
+	json::JSONValue root = json::JSONObject(j);
+	TestChecks::check(json::JSONPointer().find(root) == &root && json::JSONPointer("").find(j) == nullptr, "the root pointer");
+
+	// A path index points at the values, and rebuild follows them when they move
+	json::JSONPathIndex index(j);
+	const json::JSONPointer nested = "/object/01";
+	const json::JSONPointer element = "/list/1";
+	const json::JSONPointer added = "/added";
+	TestChecks::check(std::get<int>(index.get(nested)) == 21 && std::get<int>(index.get(element)) == 11, "the index finds values");
+	TestChecks::check(index.find(added) == nullptr && index.size() == 3, "pointers that lead nowhere are indexed too");
+
+	// Members before the ones pointed at are erased, and enough added that every vector moves
+	j.erase("a/b");
+	std::get<json::JSONObject>(j.at("object")).erase("0");
+	std::get<json::JSONArray>(j.at("list")).erase(std::get<json::JSONArray>(j.at("list")).begin());
+	for(int i = 0; i < 1000; ++i)
+		j.emplace("filler_" + std::to_string(i), i);
+	j.emplace("added", 30);
+	std::get<json::JSONObject>(j.at("object")).emplace("more", 23);
+
+	index.rebuild();
+	TestChecks::check(index.find(nested) == nested.find(j) && std::get<int>(index.get(nested)) == 21, "rebuild follows a moved member");
+	TestChecks::check(index.find(element) == element.find(j) && std::get<int>(index.get(element)) == 12, "rebuild follows a moved element");
+	TestChecks::check(index.find(added) != nullptr && std::get<int>(index.get(added)) == 30, "rebuild finds members that were added");
+
+	// Values that were erased lead nowhere after rebuild
+	j.erase("object");
+	index.rebuild();
+	TestChecks::check(index.find(nested) == nullptr, "rebuild forgets erased values");
+	try {
+		index.get(nested);
+		TestChecks::check(false, "get throws for an erased value");
+	}
+	catch(json::JSONException&) {
+	}
+
+	return TestChecks::report();
+}
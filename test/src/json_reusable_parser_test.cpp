@@ -0,0 +1,152 @@
+/**
+ * @file 		json_reusable_parser_test.cpp
+ * @brief	  Check that a JSONReusableParser stops allocating once its buffers fit, and recovers from errors
+ *
+ * 	Every allocation is counted.  After a few rounds over the same documents
+ * 	parseTape, parseArena and write must not allocate at all.  A text that
+ * 	fails part way through must leave the parser giving the right results,
+ * 	and the key pool must be emptied once it holds MAX_POOLED_KEYS keys
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_arena_document.h"
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_reusable_parser.h"
+#include "json_util/json_serializer.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_checks.h"
+#include "test_documents.h"
+
+/// Number of allocations made since the program started
+static std::atomic<std::size_t> allocations(0);
+
+void* operator new(std::size_t size) {
+	++allocations;
+	if(void* memory = std::malloc(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+/// Reach the size of the key pool and its limit
+class PoolParser : public json::JSONReusableParser {
+	public:
+		std::size_t getPooledKeys() const {
+			return this->keys.size();
+		}
+
+		static std::size_t getMaxPooledKeys() {
+			return json::JSONReusableParser::MAX_POOLED_KEYS;
+		}
+};
+
+/// Build an object of long keys that no other call builds
+std::string buildUniqueKeys(int first, int count) {
+	std::string text = "{";
+	for(int i = first; i < first + count; ++i)
+		text += ((i == first) ? "\"" : ", \"") + std::string("a key too long to be inline number ") + std::to_string(i) + "\" : 1";
+	return text + "}";
+}
+
+/// Report if a value holds the same as the document a text parses to
+bool same(const json::JSONValue& value, const std::string& text) {
+	return std::visit(json::JSONCompare{json::JSONTextParser::parseValue(text)}, value);
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(16);
+	PoolParser parser;
+
+	// Documents of different sizes, and what the parser writes for each
+	std::vector<std::string> texts;
+	std::vector<json::JSON> documents;
+	for(int members : {1, 40, 5, 300, 20}) {
+		texts.push_back(TestDocuments::generate(rng, members));
+		documents.push_back(json::JSONTextParser::parse(texts.back()));
+	}
+
+	// ----- Tests -----
+	// Once the buffers have grown to the largest document, a round over all of them allocates nothing
+	const auto round = [&]() {
+		for(std::size_t i = 0; i < texts.size(); ++i) {
+			parser.parseTape(texts[i]);
+			parser.parseArena(texts[i]);
+			parser.write(documents[i]);
+			parser.write(documents[i], true);
+		}
+	};
+	for(int warmUp = 0; warmUp < 3; ++warmUp)
+		round();
+
+	const std::size_t before = allocations;
+	for(int steady = 0; steady < 5; ++steady)
+		round();
+	const std::size_t steadyAllocations = allocations - before;
+	TestChecks::check(steadyAllocations == 0, "parseTape, parseArena and write allocate nothing in steady state, made " +
+			std::to_string(steadyAllocations));
+
+	// Each result is still the document it was parsed from or the text for it
+	for(std::size_t i = 0; i < texts.size(); ++i) {
+		TestChecks::check(same(parser.parseTape(texts[i]).getRoot().toJSONValue(), texts[i]), "the tape of document " +
+				std::to_string(i));
+		TestChecks::check(same(json::JSONArenaDocument::toJSONValue(parser.parseArena(texts[i])), texts[i]),
+				"the arena value of document " + std::to_string(i));
+		TestChecks::check(parser.write(documents[i]) == json::JSONSerializer::serialize(documents[i], false) &&
+				parser.write(documents[i], true) == json::JSONSerializer::serialize(documents[i], true),
+				"the text written for document " + std::to_string(i));
+	}
+
+	// A text that fails part way through leaves nothing behind for the next parse
+	for(const std::string& broken : {texts[3].substr(0, texts[3].size() / 2), texts[1] + " 1",
+			std::string("{\"a\" : [1, 2}"), std::string("[\"\\q\"]")}) {
+		TestChecks::check(TestChecks::throws([&] { parser.parseTape(broken); }), "parseTape rejects a broken text");
+		TestChecks::check(same(parser.parseTape(texts[2]).getRoot().toJSONValue(), texts[2]),
+				"parseTape works after a failure");
+		TestChecks::check(TestChecks::throws([&] { parser.parseArena(broken); }), "parseArena rejects a broken text");
+		TestChecks::check(same(json::JSONArenaDocument::toJSONValue(parser.parseArena(texts[2])), texts[2]),
+				"parseArena works after a failure");
+	}
+
+	// The key pool is emptied before the parse that finds it full, keys already handed out stay valid
+	const int perDocument = 10000;
+	const json::JSON firstKeys = parser.parse(buildUniqueKeys(0, perDocument));
+	std::size_t largest = 0;
+	bool emptied = false;
+	for(int n = 1; n * perDocument <= static_cast<int>(PoolParser::getMaxPooledKeys()) + 2 * perDocument; ++n) {
+		const std::size_t pooled = parser.getPooledKeys();
+		parser.parse(buildUniqueKeys(n * perDocument, perDocument));
+		if(parser.getPooledKeys() < pooled)
+			emptied = true;
+		largest = std::max(largest, parser.getPooledKeys());
+	}
+	TestChecks::check(emptied, "the pool is emptied once it is full");
+	TestChecks::check(largest < PoolParser::getMaxPooledKeys() + perDocument, "the pool holds at most one document past the limit");
+	TestChecks::check(std::visit(json::JSONCompare{json::JSONTextParser::parseValue(buildUniqueKeys(0, perDocument))},
+			json::JSONValue(json::JSONObject(firstKeys))), "keys from before the pool was emptied stay valid");
+
+	std::cout << "allocations in steady state: " << steadyAllocations << std::endl;
+	return TestChecks::report();
+}
@@ -0,0 +1,126 @@
+/**
+ * @file 		json_string_test.cpp
+ * @brief	  Check that JSONString escapes and unescapes strings the same wherever the SIMD blocks fall
+ *
+ * 	Every character that has to be escaped, and every escape, is put at each
+ * 	position of strings up to a few blocks long, so it lands inside, at the
+ * 	edges of and in the tail after the 16 and 32 byte blocks.  Each result is
+ * 	compared with what a scan one character at a time finds, once with each
+ * 	kernel the cpu supports
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <iostream>
+#include <string>
+
+// Include JSON headers
+#include "json_util/json_exception.h"
+#include "json_util/json_string.h"
+#include "json_util/json_structural_index.h"
+
+#include "test_checks.h"
+
+/**
+ * 	@class		KernelString
+ * 	@brief		Reach the kernel JSONString scans with
+ *
+ */
+class KernelString : public json::JSONString {
+	public:
+		/// Scan with a kernel from now on
+		static void use(json::JSONStructuralIndex::Kernel kernel) {
+			JSONString::useKernel(kernel);
+		}
+};
+
+/// Longest padding tried, past two 32 byte blocks
+const std::size_t MAX_PADDING = 70;
+
+/// Report if unescaping a text throws a JSONException
+bool rejects(const std::string& text) {
+	return TestChecks::throws([&text] { json::JSONString::unescape(text); });
+}
+
+/// Find the first character that has to be escaped one character at a time
+std::size_t findEscapableSlowly(const std::string& s) {
+	for(std::size_t i = 0; i < s.size(); ++i) {
+		if(s[i] == '"' || s[i] == '\\' || static_cast<unsigned char>(s[i]) < 0x20)
+			return i;
+	}
+	return s.size();
+}
+
+int main(int argc, char **argv) {
+	// ----- Tests -----
+	for(json::JSONStructuralIndex::Kernel kernel : {json::JSONStructuralIndex::SCALAR, json::JSONStructuralIndex::SSE42,
+			json::JSONStructuralIndex::AVX2}) {
+		if(!json::JSONStructuralIndex::isSupported(kernel))
+			continue;
+		KernelString::use(kernel);
+		std::cout << "kernel: " << kernel << std::endl;
+
+		// Every character is escaped or copied, and reads back the same, wherever it is
+		for(int c = 1; c < 256; ++c) {
+			for(std::size_t before = 0; before <= MAX_PADDING; before += (before < 40) ? 1 : 7) {
+				const std::string s = std::string(before, 'a') + static_cast<char>(c) + std::string(MAX_PADDING - before, 'b');
+				const std::string escaped = json::JSONString::escape(s);
+
+				TestChecks::check(json::JSONString::findEscapable(s.data(), s.data() + s.size()) - s.data() ==
+						static_cast<std::ptrdiff_t>(findEscapableSlowly(s)), "findEscapable finds character " + std::to_string(c));
+				TestChecks::check(findEscapableSlowly(escaped) == escaped.size() || escaped[findEscapableSlowly(escaped)] == '\\',
+						"escaped text holds no raw character " + std::to_string(c));
+				TestChecks::check(json::JSONString::unescape(escaped) == s, "character " + std::to_string(c) + " reads back");
+				TestChecks::check(json::JSONString::needsEscaping(s) == (findEscapableSlowly(s) != s.size()),
+						"needsEscaping for character " + std::to_string(c));
+			}
+		}
+
+		// Control characters get the short escapes where there is one, \u00XX otherwise
+		TestChecks::check(json::JSONString::escape("\b\f\n\r\t") == "\\b\\f\\n\\r\\t", "short escapes");
+		TestChecks::check(json::JSONString::escape(std::string("\x00\x01\x1f", 3)) == "\\u0000\\u0001\\u001f", "\\u00XX escapes");
+		TestChecks::check(json::JSONString::escape("\"\\/") == "\\\"\\\\/", "quotes and backslashes are escaped, slashes are not");
+		TestChecks::check(json::JSONString::unescape("\\u0041\\u00e9\\u00E9\\u20ac") == "A\xC3\xA9\xC3\xA9\xE2\x82\xAC", "\\u escapes");
+		TestChecks::check(json::JSONString::unescape("\\/\\'") == "/'", "escaped slashes and single quotes");
+
+		// Surrogate pairs are one code point, a surrogate on its own is kept as it is
+		TestChecks::check(json::JSONString::unescape("\\ud83d\\ude00") == "\xF0\x9F\x98\x80", "a surrogate pair");
+		TestChecks::check(json::JSONString::unescape("\\uD834\\uDD1E") == "\xF0\x9D\x84\x9E", "an upper case surrogate pair");
+		TestChecks::check(json::JSONString::unescape("\\ud83d") == "\xED\xA0\xBD", "a lone high surrogate");
+		TestChecks::check(json::JSONString::unescape("\\ude00") == "\xED\xB8\x80", "a lone low surrogate");
+		TestChecks::check(json::JSONString::unescape("\\ud83dx\\ude00") == "\xED\xA0\xBDx\xED\xB8\x80", "surrogates apart");
+		TestChecks::check(json::JSONString::unescape("\\ud83d\\u0041") == "\xED\xA0\xBD" "A", "a high surrogate before another escape");
+
+		// Escaped quotes and backslashes on either side of every block edge
+		for(std::size_t before = 0; before <= MAX_PADDING; ++before) {
+			const std::string padding(before, 'a');
+			const std::string where = " after " + std::to_string(before);
+
+			// The escaped quote hides from findClose, the one after the escaped backslash does not
+			const std::string quoted = padding + "\\\"" + padding + "\\\\\"" + padding;
+			const char* close = json::JSONString::findClose(quoted.data(), quoted.data() + quoted.size(), '"');
+			TestChecks::check(close == quoted.data() + 2 * before + 4, "findClose skips escapes" + where);
+			TestChecks::check(json::JSONString::findClose(quoted.data(), quoted.data() + 2 * before + 3, '"') == nullptr,
+					"findClose finds no close" + where);
+
+			TestChecks::check(json::JSONString::unescape(padding + "\\\"" + padding + "\\\\") == padding + '"' + padding + '\\',
+					"escaped quote and backslash" + where);
+			TestChecks::check(json::JSONString::unescape(padding + "\\\\\\\"\\\\") == padding + "\\\"\\", "escapes in a row" + where);
+			TestChecks::check(json::JSONString::unescape(padding + "\\ud83d\\ude00") == padding + "\xF0\x9F\x98\x80",
+					"a surrogate pair" + where);
+
+			std::string scratch;
+			TestChecks::check(json::JSONString::unescaped(padding, scratch).data() == padding.data(), "text without escapes is not copied" + where);
+
+			// Broken escapes throw wherever they are, followed by text that is not hex
+			for(const char* broken : {"\\", "\\q", "\\x41", "\\u", "\\u12", "\\u12G4", "\\ud83d\\u12", "\\U0041"}) {
+				TestChecks::check(rejects(padding + broken), std::string("rejects ") + broken + where);
+				TestChecks::check(rejects(padding + broken + std::string(before, 'z')), std::string("rejects ") + broken + " then text" + where);
+			}
+		}
+	}
+
+	return TestChecks::report();
+}
@@ -0,0 +1,154 @@
+/**
+ * @file 		json_structural_index_test.cpp
+ * @brief	  Check that texts parse the same with and without a structural index
+ *
+ * 	The cursor only jumps through a JSONStructuralIndex for texts of at least
+ * 	STRUCTURAL_INDEX_THRESHOLD characters, so the threshold is set to 0 to
+ * 	index every text, and past the largest to index none.  Every kernel the
+ * 	cpu supports must find the same masks and positions as the scalar one
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <variant>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_structural_index.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_documents.h"
+
+/**
+ * 	@class		IndexedParser
+ * 	@brief		Reach the threshold of the text parser
+ *
+ */
+class IndexedParser : public json::JSONTextParser {
+	public:
+		/// Set the length texts start being indexed at
+		static void setThreshold(std::size_t threshold) {
+			JSONTextParser::STRUCTURAL_INDEX_THRESHOLD = threshold;
+		}
+};
+
+/**
+ * 	@class		KernelIndex
+ * 	@brief		Reach the block scan of the structural index
+ *
+ */
+class KernelIndex : public json::JSONStructuralIndex {
+	public:
+		/// Report if a kernel finds the same masks in a block as the scalar kernel
+		static bool sameMasks(const char* block, Kernel kernel) {
+			BlockMasks expected, found;
+			JSONStructuralIndex::scanBlock(block, SCALAR, expected);
+			JSONStructuralIndex::scanBlock(block, kernel, found);
+			return expected.quote == found.quote && expected.singleQuote == found.singleQuote &&
+					expected.backslash == found.backslash && expected.op == found.op &&
+					expected.whitespace == found.whitespace;
+		}
+};
+
+/// Report if a kernel builds the same index for a text as the scalar kernel
+bool sameIndex(const std::string& text, json::JSONStructuralIndex::Kernel kernel) {
+	json::JSONStructuralIndex expected, found;
+	const bool expectedValid = expected.build(text, json::JSONStructuralIndex::SCALAR);
+	return found.build(text, kernel) == expectedValid && found.getPositions() == expected.getPositions();
+}
+
+/// Parse a text with every text indexed and with none, and report if the documents match
+bool parseBoth(const std::string& text) {
+	IndexedParser::setThreshold(0);
+	json::JSONValue indexed = json::JSONTextParser::parseValue(text);
+
+	IndexedParser::setThreshold(std::numeric_limits<std::size_t>::max());
+	json::JSONValue scanned = json::JSONTextParser::parseValue(text);
+
+	IndexedParser::setThreshold(16 * 1024);
+	return std::visit(json::JSONCompare{indexed}, scanned);
+}
+
+/// Report if a text is rejected both with and without an index
+bool rejectBoth(const std::string& text) {
+	int failures = 0;
+	for(std::size_t threshold : {std::size_t(0), std::numeric_limits<std::size_t>::max()}) {
+		IndexedParser::setThreshold(threshold);
+		try {
+			json::JSONTextParser::parseValue(text);
+		}
+		catch(json::JSONException&) {
+			++failures;
+		}
+	}
+
+	IndexedParser::setThreshold(16 * 1024);
+	return failures == 2;
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(2);
+	int mismatches = 0;
+
+	// ----- Tests -----
+	// Small and large documents, the large ones past the default threshold
+	for(int i = 0; i < 300; ++i) {
+		const std::string text = TestDocuments::generate(rng, 1 + rng() % ((i % 10 == 0) ? 2000 : 40));
+		if(!parseBoth(text)) {
+			++mismatches;
+			std::cout << "mismatch: " << text.substr(0, 200) << std::endl;
+		}
+	}
+
+	// Top level arrays and strings ending in backslashes
+	if(!parseBoth("[\"a\\\\\", \"\\\\\\\"\", [], {}, \"\\\\\"]"))
+		++mismatches;
+
+	// Broken texts are rejected both ways
+	int accepted = 0;
+	for(const char* text : {"{\"a\" : \"no close}", "{\"a\" : [1, 2}", "{\"a\\\" : 1}", "[1, 2] 3", "{\"a\" 1}"}) {
+		if(!rejectBoth(text)) {
+			++accepted;
+			std::cout << "accepted: " << text << std::endl;
+		}
+	}
+
+	// Every kernel the cpu supports finds the same masks in blocks of every character, and the same positions
+	int kernelMismatches = 0;
+	for(json::JSONStructuralIndex::Kernel kernel : {json::JSONStructuralIndex::SSE42, json::JSONStructuralIndex::AVX2}) {
+		if(!json::JSONStructuralIndex::isSupported(kernel))
+			continue;
+
+		const std::string characters = "\"'\\{}[]:, \t\n\raz0-\x80\xff";
+		for(int n = 0; n < 2000; ++n) {
+			char block[64];
+			for(char& c : block)
+				c = (n % 2 == 0) ? characters[rng() % characters.size()] : static_cast<char>(rng());
+			if(!KernelIndex::sameMasks(block, kernel)) {
+				++kernelMismatches;
+				std::cout << "kernel " << kernel << " masks differ" << std::endl;
+			}
+		}
+
+		for(int i = 0; i < 200; ++i) {
+			const std::string text = TestDocuments::generate(rng, 1 + rng() % ((i % 10 == 0) ? 2000 : 40));
+			for(const std::string& cut : {text, text.substr(0, rng() % text.size()), "'" + text}) {
+				if(!sameIndex(cut, kernel)) {
+					++kernelMismatches;
+					std::cout << "kernel " << kernel << " positions differ: " << cut.substr(0, 200) << std::endl;
+				}
+			}
+		}
+	}
+
+	std::cout << "kernel: " << json::JSONStructuralIndex::getKernel() << ", mismatches: " << mismatches <<
+			", broken texts accepted: " << accepted << ", kernel mismatches: " << kernelMismatches << std::endl;
+	return (mismatches == 0 && accepted == 0 && kernelMismatches == 0) ? 0 : 1;
+}
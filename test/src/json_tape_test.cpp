@@ -0,0 +1,140 @@
+/**
+ * @file 		json_tape_test.cpp
+ * @brief	  Check that a tape holds the same document as the text it was parsed from
+ *
+ * 	Each text is parsed onto a tape and into a JSONValue.  The tape is walked
+ * 	member by member and element by element against the value, and the text
+ * 	JSONParser builds from the tape is parsed again and compared with it.  The
+ * 	text of the tape, and of the compact and persistent forms of the value, must
+ * 	be the text JSONSerializer writes for the value
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_compare.h"
+#include "json_util/json_exception.h"
+#include "json_util/json_parser.h"
+#include "json_util/json_serializer.h"
+#include "json_util/json_tape.h"
+#include "json_util/json_text_parser.h"
+
+#include "test_documents.h"
+
+/// Report if a value on a tape holds the same as a JSONValue, walking its members and elements
+bool walk(const json::JSONTapeValue& tapeValue, const json::JSONValue& value) {
+	if(tapeValue.isObject()) {
+		const json::JSONObject* object = std::get_if<json::JSONObject>(&value);
+		if(object == nullptr || tapeValue.size() != object->size())
+			return false;
+
+		// Members come off the tape in the order of the text, the order the object keeps
+		auto member = object->begin();
+		for(const json::JSONTapeMember& tapeMember : tapeValue.getObject()) {
+			if(member == object->end() || tapeMember.first != member->first.view() ||
+					!walk(tapeMember.second, member->second) ||
+					tapeValue[tapeMember.first].getIndex() != tapeMember.second.getIndex())
+				return false;
+			++member;
+		}
+		return member == object->end();
+	}
+
+	if(tapeValue.isArray()) {
+		const json::JSONArray* array = std::get_if<json::JSONArray>(&value);
+		if(array == nullptr || tapeValue.size() != array->size())
+			return false;
+
+		std::size_t position = 0;
+		for(const json::JSONTapeValue& element : tapeValue.getArray()) {
+			if(position == array->size() || !walk(element, (*array)[position]) ||
+					tapeValue[position].getIndex() != element.getIndex())
+				return false;
+			++position;
+		}
+		return position == array->size();
+	}
+
+	return std::visit(json::JSONCompare{value}, tapeValue.toJSONValue());
+}
+
+/// Report if a text is rejected by parseTape
+bool rejectTape(const std::string& text) {
+	try {
+		json::JSONTextParser::parseTape(text);
+		return false;
+	}
+	catch(json::JSONException&) {
+		return true;
+	}
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(15);
+	int mismatches = 0;
+
+	// ----- Tests -----
+	// Documents and bare values, some with thousands of members
+	std::vector<std::string> texts = {"{}", "[]", "[[], {}, [[]]]", "{\"\" : \"\", \"a\" : {\"\" : null}}",
+			"[\"\\ud83d\\ude00\", -0.5e-3, 12345678901234, 18446744073709551615, -9223372036854775808]",
+			"\"\\\\\\\"\\u20ac\"", "-123", "1.5e10", "true", "false", "null"};
+	for(int i = 0; i < 200; ++i)
+		texts.push_back(TestDocuments::generate(rng, 1 + rng() % ((i % 20 == 0) ? 2000 : 30)));
+
+	for(const std::string& text : texts) {
+		const json::JSONValue expected = json::JSONTextParser::parseValue(text);
+		const json::JSONTape tape = json::JSONTextParser::parseTape(text);
+
+		// The tape walked by its iterators, and built back into a value
+		if(!walk(tape.getRoot(), expected) ||
+				!std::visit(json::JSONCompare{expected}, tape.getRoot().toJSONValue())) {
+			++mismatches;
+			std::cout << "tape differs: " << text.substr(0, 200) << std::endl;
+			continue;
+		}
+
+		// The text built from the tape parses back to the same document
+		for(const std::string& built : {json::JSONParser::parse(tape), json::JSONParser::parseCompact(tape)}) {
+			const json::JSONValue reparsed = json::JSONTextParser::parseValue(built);
+			if(!std::visit(json::JSONCompare{expected}, reparsed)) {
+				++mismatches;
+				std::cout << "text from the tape differs: " << built.substr(0, 200) << std::endl;
+			}
+		}
+
+		// The tape, and the compact and persistent forms of the value, give the text the value does
+		const json::JSONCompactValue compactValue = json::JSONCompactValue::fromJSONValue(expected);
+		const json::JSONPersistentDocument persistent{json::JSONPersistentValue(expected)};
+		for(bool compact : {false, true}) {
+			json::JSONSerializer serializer(compact);
+			serializer.write(expected);
+			const std::string_view text = serializer.getText();
+			if((compact ? json::JSONParser::parseCompact(tape) : json::JSONParser::parse(tape)) != text ||
+					(compact ? json::JSONParser::parseCompact(compactValue) : json::JSONParser::parse(compactValue)) != text ||
+					(compact ? json::JSONParser::parseCompact(persistent) : json::JSONParser::parse(persistent)) != text) {
+				++mismatches;
+				std::cout << "text differs from the serializer's: " << text.substr(0, 200) << std::endl;
+			}
+		}
+	}
+
+	// Broken texts are rejected
+	int accepted = 0;
+	for(const char* text : {"{\"a\" : \"no close}", "{\"a\" : [1, 2}", "[1, 2", "{\"a\" 1}", "[tru]", "\"\\q\"", "[1] 2"}) {
+		if(!rejectTape(text)) {
+			++accepted;
+			std::cout << "accepted: " << text << std::endl;
+		}
+	}
+
+	std::cout << "mismatches: " << mismatches << ", broken texts accepted: " << accepted << std::endl;
+	return (mismatches == 0 && accepted == 0) ? 0 : 1;
+}
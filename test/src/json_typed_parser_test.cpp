@@ -0,0 +1,154 @@
+/**
+ * @file 		json_typed_parser_test.cpp
+ * @brief	  Check that the typed parser reads text into fields the same as JSONFields reads the parsed document
+ *
+ * 	Every text is read both ways, straight into a Record by JSONTypedParser
+ * 	and through JSONTextParser::parse and JSONFields::fromJSON.  Both must
+ * 	accept it or both reject it, and what they read must serialize the same.
+ * 	The numbers cover what from_chars takes that json does not, and what does
+ * 	not fit the field it is read into.  Repeated keys keep their first value
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_exception.h"
+#include "json_util/json_fields.h"
+#include "json_util/json_text_parser.h"
+#include "json_util/json_typed_parser.h"
+
+/// A field of each kind of number
+struct Numbers {
+	int i = 0;
+	unsigned int u = 0;
+	uint8_t small = 0;
+	int64_t big = 0;
+	uint64_t ubig = 0;
+	float f = 0;
+	double d = 0;
+
+	JSON_FIELDS(Numbers, i, u, small, big, ubig, f, d)
+};
+
+/// Nested records and the other kinds of fields
+struct Record {
+	std::string name;
+	bool active = false;
+	Numbers numbers;
+	std::vector<int> counts;
+	std::vector<Numbers> history;
+
+	JSON_FIELDS(Record, name, active, numbers, counts, history)
+};
+
+/// What reading a text gave, the record serialized or the error
+std::string readTyped(const std::string& text) {
+	try {
+		return json::JSONFields::serialize(json::JSONTypedParser::parse<Record>(text), true);
+	}
+	catch(json::JSONException&) {
+		return "rejected";
+	}
+}
+
+/// What reading a text through a document gave, the record serialized or the error
+std::string readDocument(const std::string& text) {
+	try {
+		return json::JSONFields::serialize(json::JSONFields::fromJSON<Record>(json::JSONTextParser::parse(text)), true);
+	}
+	catch(json::JSONException&) {
+		return "rejected";
+	}
+}
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(24);
+	int mismatches = 0, accepted = 0;
+
+	// ----- Tests -----
+	// Numbers json allows, with edges of each field's range and things from_chars reads differently
+	const std::vector<std::string> valid = {"0", "-0", "1", "-1", "0.5", "-0.5", "1e5", "1E+5", "1e-5", "-0.0e0", "2.0",
+			"255", "2147483647", "-2147483648", "4294967295", "9223372036854775807", "-9223372036854775808",
+			"18446744073709551615", "1e-400", "123456789012345678901234567890", "3.4e38", "1.7976931348623157e308"};
+
+	// Texts from_chars takes, json does not
+	const std::vector<std::string> invalid = {"01", "-01", "00", "01.5", "1.", "1.e5", "-.5", ".5", "-", "+1", "1e", "1e+",
+			"1E-", "0x10", "inf", "-inf", "nan", "-nan", "1e400", "-1e400", "1-", "--1", "1..2", "1e5.5", "Infinity"};
+
+	std::vector<std::string> texts;
+	for(const char* field : {"i", "u", "small", "big", "ubig", "f", "d"}) {
+		for(const std::vector<std::string>* numbers : {&valid, &invalid}) {
+			for(const std::string& number : *numbers) {
+				texts.push_back("{\"numbers\" : {\"" + std::string(field) + "\" : " + number + "}}");
+				texts.push_back("{\"history\" : [{\"" + std::string(field) + "\" : " + number + "}], \"name\" : \"x\"}");
+			}
+		}
+	}
+	for(const std::vector<std::string>* numbers : {&valid, &invalid}) {
+		for(const std::string& number : *numbers)
+			texts.push_back("{\"counts\" : [1, " + number + ", 3]}");
+	}
+
+	// Records of random values, some of them out of the range of their fields
+	for(int n = 0; n < 300; ++n) {
+		const int64_t value = static_cast<int64_t>(rng()) - (1LL << 31) + ((rng() % 4 == 0) ? (1LL << 40) : 0);
+		texts.push_back("{\"name\" : \"record " + std::to_string(n) + "\", \"active\" : true, \"numbers\" : {\"i\" : " +
+				std::to_string(value) + ", \"u\" : " + std::to_string(value) + ", \"small\" : " + std::to_string(value % 512) +
+				", \"big\" : " + std::to_string(value * 1000) + ", \"f\" : " + std::to_string(value / 7.0) +
+				"}, \"counts\" : [" + std::to_string(value) + "]}");
+	}
+
+	// Other values in number fields, broken structure, and a member that is not a field
+	for(const char* text : {"{\"numbers\" : {\"i\" : \"1\"}}", "{\"numbers\" : {\"i\" : true}}", "{\"numbers\" : {\"i\" : null}}",
+			"{\"numbers\" : {\"i\" : [1]}}", "{\"active\" : 1}", "{\"name\" : 1}", "{\"counts\" : [1, 2}",
+			"{\"numbers\" : {\"i\" : 1}", "{\"numbers\" : {\"i\" 1}}", "{\"counts\" : [1 2]}", "{} 1",
+			"{\"unknown\" : [1, {\"a\" : 2}], \"name\" : \"x\"}"})
+		texts.push_back(text);
+
+	// Repeated keys, the first value is kept on both paths
+	for(const char* text : {"{\"a\" : 1, \"a\" : 2}", "{\"numbers\" : {\"i\" : 1, \"i\" : 2}}",
+			"{\"name\" : \"a\", \"active\" : true, \"name\" : \"b\"}", "{\"n\\u0061me\" : \"a\", \"name\" : \"b\"}",
+			"{\"counts\" : [1], \"counts\" : [2, 3]}", "{\"history\" : [{\"d\" : 1.5, \"d\" : 2.5}], \"history\" : []}",
+			"{\"numbers\" : {\"i\" : 1}, \"numbers\" : {\"u\" : 2}}", "{\"numbers\" : {\"i\" : 1, \"i\" : \"not a number\"}}"})
+		texts.push_back(text);
+
+	for(const std::string& text : texts) {
+		const std::string typed = readTyped(text);
+		const std::string document = readDocument(text);
+		if(typed != document) {
+			++mismatches;
+			std::cout << "mismatch: " << text << std::endl << "\ttyped:    " << typed << std::endl <<
+					"\tdocument: " << document << std::endl;
+		}
+		if(typed != "rejected")
+			++accepted;
+	}
+
+	// Each invalid number is rejected, not only rejected the same by both
+	int invalidAccepted = 0;
+	for(const std::string& number : invalid) {
+		if(readTyped("{\"numbers\" : {\"d\" : " + number + "}}") != "rejected") {
+			++invalidAccepted;
+			std::cout << "accepted: " << number << std::endl;
+		}
+	}
+
+	// The first of repeated keys is the one read, not only read the same by both
+	const Record repeated = json::JSONTypedParser::parse<Record>("{\"numbers\" : {\"i\" : 1, \"i\" : 2}, "
+			"\"name\" : \"first\", \"name\" : \"second\", \"counts\" : [1], \"counts\" : [2, 3]}");
+	const bool firstKept = repeated.numbers.i == 1 && repeated.name == "first" && repeated.counts == std::vector<int>{1};
+	if(!firstKept)
+		std::cout << "repeated keys did not keep the first value" << std::endl;
+
+	std::cout << "texts: " << texts.size() << ", accepted: " << accepted << ", mismatches: " << mismatches <<
+			", invalid numbers accepted: " << invalidAccepted << std::endl;
+	return (mismatches == 0 && invalidAccepted == 0 && firstKept) ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file 		json_writer_test.cpp
+ * @brief	  Check that a JSONWriter writes the same text as a JSONSerializer, and catches calls that do not nest
+ *
+ * 	Documents are walked value by value and written one call at a time, to
+ * 	the buffer and through a sink, and compared with what a JSONSerializer
+ * 	writes for the whole document in both layouts.  Builds without NDEBUG
+ * 	must throw for each way the calls can fail to nest
+ *
+ * @author		Gabriel Shelton		sheltongabe
+ * @date 		  10-18-2026
+ * @version		0.1
+ */
+
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// Include JSON headers
+#include "json_util/json_exception.h"
+#include "json_util/json_serializer.h"
+#include "json_util/json_text_parser.h"
+#include "json_util/json_writer.h"
+
+#include "test_checks.h"
+#include "test_documents.h"
+
+/// Write a value one call at a time, containers with begin, key and end
+void writeValue(json::JSONWriter& writer, const json::JSONValue& value);
+
+/// Write the members of an object one call at a time
+void writeObject(json::JSONWriter& writer, const json::JSONObject& object) {
+	writer.beginObject();
+	for(const auto& member : object) {
+		writer.key(member.first.view());
+		writeValue(writer, member.second);
+	}
+	writer.endObject();
+}
+
+//
+// writeValue (json::JSONWriter&, const json::JSONValue&) -> void
+//
+void writeValue(json::JSONWriter& writer, const json::JSONValue& value) {
+	if(const json::JSONObject* object = std::get_if<json::JSONObject>(&value)) {
+		writeObject(writer, *object);
+	}
+	else if(const json::JSONArray* array = std::get_if<json::JSONArray>(&value)) {
+		writer.beginArray();
+		for(const json::JSONValue& element : *array)
+			writeValue(writer, element);
+		writer.endArray();
+	}
+	else if(std::holds_alternative<std::monostate>(value)) {
+		writer.null();
+	}
+	else {
+		std::visit([&writer](const auto& item) {
+			if constexpr(!std::is_same_v<std::decay_t<decltype(item)>, std::monostate> &&
+					!std::is_same_v<std::decay_t<decltype(item)>, json::JSONObject> &&
+					!std::is_same_v<std::decay_t<decltype(item)>, json::JSONArray>)
+				writer.value(item);
+		}, value);
+	}
+}
+
+/// A JSONAble whose writeJSON leaves an array open
+class Unclosed : public json::JSONAble {
+	public:
+		json::JSON getJSON() const override {
+			return json::JSON();
+		}
+
+		void writeJSON(json::JSONWriter& writer) const override {
+			writer.beginArray().value(1);
+		}
+};
+
+/// A JSONAble that writes itself member by member
+class Point : public json::JSONAble {
+	public:
+		json::JSON getJSON() const override {
+			json::JSON j;
+			j.emplace("x", 1);
+			j.emplace("y", 2.5);
+			return j;
+		}
+
+		void writeJSON(json::JSONWriter& writer) const override {
+			writer.beginObject().member("x", 1).member("y", 2.5).endObject();
+		}
+};
+
+int main(int argc, char **argv) {
+	std::mt19937 rng(22);
+
+	// ----- Tests -----
+	// Documents written call by call match the serializer, in both layouts, to the buffer and through a sink
+	std::vector<std::string> texts = {"{}", "{\"a\" : []}", "{\"a\" : {\"b\" : [[], {}, [1, [2, {\"c\" : null}]]]}}"};
+	for(int i = 0; i < 60; ++i)
+		texts.push_back(TestDocuments::generate(rng, 1 + rng() % ((i % 10 == 0) ? 3000 : 20)));
+
+	for(const std::string& text : texts) {
+		const json::JSON j = json::JSONTextParser::parse(text);
+		for(bool compact : {false, true}) {
+			const std::string expected = json::JSONSerializer::serialize(j, compact);
+			const std::string layout = compact ? " compact: " : " pretty: ";
+
+			json::JSONWriter writer(compact);
+			writeObject(writer, j);
+			TestChecks::check(writer.getText() == expected && writer.getDepth() == 0, "written call by call" + layout +
+					text.substr(0, 100));
+
+			writer.clear();
+			writer.value(j);
+			TestChecks::check(writer.getText() == expected, "written as one value" + layout + text.substr(0, 100));
+
+			std::ostringstream stream;
+			json::JSONStreamSink sink(stream);
+			json::JSONWriter streaming(sink, compact);
+			writeObject(streaming, j);
+			streaming.flush();
+			TestChecks::check(stream.str() == expected, "written through a sink" + layout + text.substr(0, 100));
+		}
+	}
+
+	// A JSONAble writes the same through its hook as through getJSON
+	json::JSONArray both;
+	both.push_back(json::JSONObject(Point().getJSON()));
+	both.push_back(json::JSONObject(Point().getJSON()));
+	json::JSON holder;
+	holder.emplace("both", both);
+	for(bool compact : {false, true}) {
+		json::JSONWriter writer(compact);
+		writer.beginObject().key("both").beginArray().value(Point()).value(Point().getJSON()).endArray().endObject();
+		TestChecks::check(writer.getText() == json::JSONSerializer::serialize(holder, compact),
+				"a JSONAble writes the same through its hook");
+	}
+
+#ifndef NDEBUG
+	// Calls that do not nest throw, each from a fresh writer
+	const auto misuse = [](const std::function<void(json::JSONWriter&)>& calls) {
+		return TestChecks::throws([&calls] {
+			json::JSONWriter writer;
+			calls(writer);
+		});
+	};
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginArray().key("a"); }), "a key in an array");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.key("a"); }), "a key at the top level");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginObject().value(1); }), "a value without a key");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginObject().key("a").key("b"); }), "a key after a key");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginObject().key("a").endObject(); }), "an end after a key");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginObject().endArray(); }), "an array end closing an object");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginArray().endObject(); }), "an object end closing an array");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.endObject(); }), "an object end with nothing open");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.endArray(); }), "an array end with nothing open");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.value(1).value(2); }), "a second top level value");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginArray().endArray().beginObject(); }),
+			"a second top level container");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.value(Unclosed()); }), "a writeJSON that leaves a container open");
+	TestChecks::check(misuse([](json::JSONWriter& w) { w.beginObject().key("a").value(Unclosed()); }),
+			"a nested writeJSON that leaves a container open");
+
+	// What nests does not throw, and clear starts a new text
+	TestChecks::check(!misuse([](json::JSONWriter& w) { w.value(1); w.clear(); w.value(2); }), "clear starts a new text");
+	TestChecks::check(!misuse([](json::JSONWriter& w) { w.beginObject().member("a", Point()).endObject(); }),
+			"a JSONAble as a member");
+#endif
+
+	return TestChecks::report();
+}
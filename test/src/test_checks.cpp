@@ -0,0 +1,50 @@
+/**
+ *  @file		test_checks.cpp
+ *  @brief	  Count and report the checks of a test that failed
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+
+#include "json_util/json_exception.h"
+
+#include "test_checks.h"
+
+// Initialize static variables
+int TestChecks::failures = 0;
+
+//
+// check (bool, const std::string&) -> void
+//
+void TestChecks::check(bool passed, const std::string& what) {
+	if(!passed) {
+		++TestChecks::failures;
+		std::cout << "failed: " << what << std::endl;
+	}
+}
+
+//
+// throws (const std::function<void()>&) -> bool
+//
+bool TestChecks::throws(const std::function<void()>& run) {
+	try {
+		run();
+		return false;
+	}
+	catch(json::JSONException&) {
+		return true;
+	}
+}
+
+//
+// report () -> int
+//
+int TestChecks::report() {
+	std::cout << "failed checks: " << TestChecks::failures << std::endl;
+	return (TestChecks::failures == 0) ? 0 : 1;
+}
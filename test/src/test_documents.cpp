@@ -0,0 +1,123 @@
+/**
+ *  @file		test_documents.cpp
+ *  @brief	  Generate random json text
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-18-2026
+ *  @version	0.1
+ */
+
+#include <cstdint>
+
+#include "test_documents.h"
+
+//
+// generate (std::mt19937&, int) -> std::string
+//
+std::string TestDocuments::generate(std::mt19937& rng, int numMembers) {
+	std::string text = "{";
+	for(int i = 0; i < numMembers; ++i) {
+		if(i != 0)
+			text += ',';
+		TestDocuments::generateSpace(rng, text);
+
+		// Keys are escaped now and then, the index keeps them different
+		text += (rng() % 8 == 0) ? "\"member\\t\\\"" : "\"member_";
+		text += std::to_string(i) + '\"';
+		TestDocuments::generateSpace(rng, text);
+		text += ':';
+		TestDocuments::generateSpace(rng, text);
+		TestDocuments::generateValue(rng, text, 0);
+	}
+	TestDocuments::generateSpace(rng, text);
+	text += '}';
+	return text;
+}
+
+//
+// generateString (std::mt19937&, std::string&) -> void
+//
+void TestDocuments::generateString(std::mt19937& rng, std::string& text) {
+	static const char* const ESCAPES[] = {
+		"\\\"", "\\\\", "\\/", "\\b", "\\f", "\\n", "\\r", "\\t",
+		"\\u00e9", "\\u0001", "\\u20ac", "\\ud83d\\ude00", "\\\\\\\""
+	};
+
+	// Long strings run across several 16 and 32 byte blocks
+	const int length = (rng() % 4 == 0) ? static_cast<int>(rng() % 100) : static_cast<int>(rng() % 12);
+	text += '\"';
+	for(int i = 0; i < length; ++i) {
+		if(rng() % 6 == 0)
+			text += ESCAPES[rng() % (sizeof(ESCAPES) / sizeof(ESCAPES[0]))];
+		else
+			text += static_cast<char>('a' + rng() % 26);
+	}
+	text += '\"';
+}
+
+//
+// generateValue (std::mt19937&, std::string&, int) -> void
+//
+void TestDocuments::generateValue(std::mt19937& rng, std::string& text, int depth) {
+	const int numTypes = (depth < TestDocuments::MAX_DEPTH) ? 9 : 7;
+	switch(rng() % numTypes) {
+		case 0:
+			text += std::to_string(static_cast<int>(rng() % 200000) - 100000);
+			break;
+		case 1:
+			text += std::to_string((static_cast<int>(rng() % 20000) - 10000) / 7.0);
+			break;
+		case 2:
+			text += std::to_string(static_cast<int64_t>(rng()) * 4000000 + 1);
+			break;
+		case 3:
+		case 4:
+			TestDocuments::generateString(rng, text);
+			break;
+		case 5:
+			text += (rng() % 2 == 0) ? "true" : "false";
+			break;
+		case 6:
+			text += "null";
+			break;
+		case 7: {
+			text += '{';
+			const int numMembers = rng() % 6;
+			for(int i = 0; i < numMembers; ++i) {
+				if(i != 0)
+					text += ',';
+				TestDocuments::generateSpace(rng, text);
+				text += "\"k" + std::to_string(i) + '\"';
+				TestDocuments::generateSpace(rng, text);
+				text += ':';
+				TestDocuments::generateValue(rng, text, depth + 1);
+			}
+			TestDocuments::generateSpace(rng, text);
+			text += '}';
+			break;
+		}
+		case 8: {
+			text += '[';
+			const int numElements = rng() % 6;
+			for(int i = 0; i < numElements; ++i) {
+				if(i != 0)
+					text += ',';
+				TestDocuments::generateSpace(rng, text);
+				TestDocuments::generateValue(rng, text, depth + 1);
+			}
+			TestDocuments::generateSpace(rng, text);
+			text += ']';
+			break;
+		}
+	}
+}
+
+//
+// generateSpace (std::mt19937&, std::string&) -> void
+//
+void TestDocuments::generateSpace(std::mt19937& rng, std::string& text) {
+	static const char* const SPACES[] = {"", "", " ", "\n\t", "  \r\n"};
+	text += SPACES[rng() % (sizeof(SPACES) / sizeof(SPACES[0]))];
+}
@@ -128,10 +128,14 @@ json::JSONValue TestObject::generateBaseValue(std::mt19937& rng) {
 
 		case DOUBLE:
 		{
-			// Generate 2 integers cast as doubles
+			// Generate 2 integers cast as doubles, json cannot hold the
+			// infinity or NaN a zero divisor would give
+			int divisor = 0;
+			while(divisor == 0)
+				divisor = int_generator(rng);
 			double v = static_cast<double>(
 					static_cast<double>(int_generator(rng)) / 
-					static_cast<double>(int_generator(rng)));
+					static_cast<double>(divisor));
 			value = v;
 		}
 		break;